@@ -1,54 +1,201 @@
 #include "backlight.h"
 #include "backlight_driver_common.h"
-#include "util.h"
+#ifdef BACKLIGHT_BREATHING
+#    include "timer.h"
+#    include "wait.h"
+#endif
+
+/* Sigma-delta modulated software PWM
+ *
+ * Every tick adds the 16-bit duty to an accumulator and lights the pins on the
+ * ticks where it overflows. The on-ticks are spread as evenly as the tick rate
+ * allows, so low levels dither at the highest possible frequency instead of
+ * sitting in one long off-period, and all 65536 duty values are reachable.
+ *
+ * On ChibiOS the ticks come from a virtual timer, elsewhere from the scan loop.
+ */
+#if defined(PROTOCOL_CHIBIOS) && !defined(BACKLIGHT_SOFTWARE_SCAN_LOOP)
+#    define BACKLIGHT_SOFTWARE_TIMER
+#    include <ch.h>
+#    ifndef BACKLIGHT_SOFTWARE_TICK_US
+#        define BACKLIGHT_SOFTWARE_TICK_US 100
+#    endif
+#endif
+
+/* The longest gap between two on-ticks. Lower duties are raised to fit, so
+ * the dimmest levels still pulse fast enough not to be seen flickering.
+ */
+#ifndef BACKLIGHT_SOFTWARE_MAX_PERIOD
+#    define BACKLIGHT_SOFTWARE_MAX_PERIOD 100
+#endif
+#define BACKLIGHT_SOFTWARE_MIN_DUTY ((0x10000UL + BACKLIGHT_SOFTWARE_MAX_PERIOD - 1) / BACKLIGHT_SOFTWARE_MAX_PERIOD)
+
+static volatile uint16_t s_duty        = 0; // duty actually output, 0-0xFFFF
+static uint16_t          s_level_duty  = 0; // duty of the current level, before breathing
+static uint16_t          s_accumulator = 0;
+static bool              s_pins_on     = false;
 
 #ifdef BACKLIGHT_BREATHING
-#    error "Backlight breathing is not available for software PWM. Please disable."
+static bool     breathing       = false;
+static uint32_t breathing_start = 0;
+static uint8_t  breathing_index = UINT8_MAX;
 #endif
 
-static uint16_t s_duty_pattern = 0;
+// See http://jared.geek.nz/2013/feb/linear-led-pwm
+static uint16_t cie_lightness(uint16_t v) {
+    if (v <= 5243)    // if below 8% of max
+        return v / 9; // same as dividing by 900%
+    else {
+        uint32_t y = (((uint32_t)v + 10486) << 12) / (10486 + 0xFFFFUL); // add 16% of max and compare
+        // to get a useful result with integer division, we shift left in the expression above
+        // and revert what we've done again after cubing. 12 fractional bits keep the result
+        // within 16-bit resolution without overflowing 32 bits.
+        y = (y * y >> 12) * y >> 8;
+        if (y > 0xFFFFUL) // prevent overflow
+            return 0xFFFFU;
+        else
+            return (uint16_t)y;
+    }
+}
 
-// clang-format off
+static uint16_t bounded_duty(uint16_t duty) {
+    if (duty != 0 && duty < BACKLIGHT_SOFTWARE_MIN_DUTY) {
+        return BACKLIGHT_SOFTWARE_MIN_DUTY;
+    }
+    return duty;
+}
 
-/** \brief PWM duty patterns
- *
- * We scale the current backlight level to an index within this array. This allows
- * backlight_task to focus on just switching LEDs on/off, and we can predict the duty pattern
- */
-static const uint16_t backlight_duty_table[] = {
-    0b0000000000000000,
-    0b1000000000000000,
-    0b1000000010000000,
-    0b1000001000010000,
-    0b1000100010001000,
-    0b1001001001001000,
-    0b1010101010101010,
-    0b1110111011101110,
-    0b1111111111111111,
-};
-#define backlight_duty_table_size ARRAY_SIZE(backlight_duty_table)
+static void backlight_software_tick(void) {
+    uint16_t duty = s_duty;
+    uint16_t next = s_accumulator + duty;
+    bool     on   = next < s_accumulator || duty == UINT16_MAX;
 
-// clang-format on
+    s_accumulator = next;
+    if (on == s_pins_on) {
+        return;
+    }
+    s_pins_on = on;
+    if (on) {
+        backlight_pins_on();
+    } else {
+        backlight_pins_off();
+    }
+}
+
+#ifdef BACKLIGHT_SOFTWARE_TIMER
+static virtual_timer_t backlight_vt;
 
-static uint8_t scale_backlight(uint8_t v) {
-    return v * (backlight_duty_table_size - 1) / BACKLIGHT_LEVELS;
+static void backlight_vt_callback(virtual_timer_t *vtp, void *p) {
+    backlight_software_tick();
 }
 
+static void backlight_software_configure(bool enable) {
+    if (enable) {
+        if (!chVTIsArmed(&backlight_vt)) {
+            chVTSetContinuous(&backlight_vt, TIME_US2I(BACKLIGHT_SOFTWARE_TICK_US), backlight_vt_callback, NULL);
+        }
+    } else {
+        chVTReset(&backlight_vt);
+        s_pins_on = false;
+        backlight_pins_off();
+    }
+}
+#else
+static void backlight_software_configure(bool enable) {}
+#endif
+
 void backlight_init_ports(void) {
     backlight_pins_init();
+#ifdef BACKLIGHT_SOFTWARE_TIMER
+    chVTObjectInit(&backlight_vt);
+#endif
+
+#ifdef BACKLIGHT_BREATHING
+    if (is_backlight_breathing()) {
+        breathing_enable();
+    }
+#endif
 }
 
 void backlight_set(uint8_t level) {
-    s_duty_pattern = backlight_duty_table[scale_backlight(level)];
+    if (level > BACKLIGHT_LEVELS) level = BACKLIGHT_LEVELS;
+
+    s_level_duty = cie_lightness((uint32_t)0xFFFFU * level / BACKLIGHT_LEVELS);
+#ifdef BACKLIGHT_BREATHING
+    if (is_breathing()) {
+        // force the next breathing step to pick up the new level
+        breathing_index = UINT8_MAX;
+        return;
+    }
+#endif
+    s_duty = bounded_duty(s_level_duty);
+    backlight_software_configure(level != 0);
 }
 
 void backlight_task(void) {
-    static uint8_t backlight_tick = 0;
+#ifdef BACKLIGHT_BREATHING
+    if (is_breathing()) {
+        breathing_task();
+    }
+#endif
+#ifndef BACKLIGHT_SOFTWARE_TIMER
+    backlight_software_tick();
+#endif
+}
 
-    if (s_duty_pattern & ((uint16_t)1 << backlight_tick)) {
-        backlight_pins_on();
-    } else {
-        backlight_pins_off();
+#ifdef BACKLIGHT_BREATHING
+#    define BREATHING_STEPS 128
+
+// clang-format off
+
+/* The 16-bit duty of each step at full brightness, already CIE corrected. To generate in python:
+ * from math import sin, pi; [cie_lightness(int(sin(x/128.0*pi)**4*255)*257) for x in range(128)]
+ */
+static const uint16_t breathing_table[BREATHING_STEPS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 28, 57, 85, 114,
+    142, 171, 228, 285, 342, 428, 485, 571, 686, 821, 976, 1141, 1379, 1651, 1956, 2364,
+    2829, 3439, 4029, 4800, 5795, 6764, 8001, 9197, 10718, 12388, 14453, 16485, 18699, 21114, 23685, 26491,
+    29123, 32344, 35332, 38504, 41371, 44897, 47523, 50815, 53107, 56041, 58451, 60350, 62230, 63533, 64198, 64865,
+    65535, 64865, 64198, 63533, 62230, 60350, 58451, 56041, 53107, 50815, 47523, 44897, 41371, 38504, 35332, 32344,
+    29123, 26491, 23685, 21114, 18699, 16485, 14453, 12388, 10718, 9197, 8001, 6764, 5795, 4800, 4029, 3439,
+    2829, 2364, 1956, 1651, 1379, 1141, 976, 821, 686, 571, 485, 428, 342, 285, 228, 171,
+    142, 114, 85, 57, 28, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+// clang-format on
+
+void breathing_task(void) {
+    uint32_t period = (uint32_t)get_breathing_period() * 1000;
+    uint8_t  index  = timer_elapsed32(breathing_start) % period * BREATHING_STEPS / period;
+    if (index == breathing_index) {
+        return;
     }
-    backlight_tick = (backlight_tick + 1) % 16;
+    breathing_index = index;
+
+    // The curve is close to a power law, so scaling the corrected values
+    // matches correcting the scaled ones without any math per step.
+    s_duty = bounded_duty((uint32_t)breathing_table[index] * s_level_duty / 0xFFFFU);
 }
+
+bool is_breathing(void) {
+    return breathing;
+}
+
+void breathing_enable(void) {
+    breathing_start = timer_read32();
+    breathing_index = UINT8_MAX;
+    breathing       = true;
+    backlight_software_configure(true);
+}
+
+void breathing_disable(void) {
+    breathing = false;
+    backlight_set(get_backlight_level());
+}
+
+void breathing_pulse(void) {
+    backlight_set(is_backlight_enabled() ? 0 : BACKLIGHT_LEVELS);
+    wait_ms(10);
+    backlight_set(is_backlight_enabled() ? get_backlight_level() : 0);
+}
+#endif
@@ -0,0 +1,150 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <math.h>
+#include <stdio.h>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "backlight.h"
+#include "backlight_driver_common.h"
+#include "backlight/tests/mock.h"
+
+void set_time(uint32_t t);
+}
+
+// One full cycle of the 16-bit modulator
+#define CYCLE_TICKS 65536UL
+
+// Runs the driver from the scan loop and returns the fraction of ticks the pins were on
+static double measure_duty(uint32_t ticks) {
+    uint32_t on = 0;
+    for (uint32_t i = 0; i < ticks; i++) {
+        backlight_task();
+        on += mock_pins_on;
+    }
+    return (double)on / ticks;
+}
+
+// CIE 1931 lightness to relative luminance, the curve the levels should follow
+static double cie1931(double lightness) {
+    double l = lightness * 100.0;
+    return l <= 8.0 ? l / 902.3 : pow((l + 16.0) / 116.0, 3);
+}
+
+class BacklightSoftware : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        mock_backlight_level     = BACKLIGHT_LEVELS;
+        mock_backlight_breathing = false;
+        backlight_init_ports();
+    }
+
+    void TearDown() override {
+        breathing_disable();
+    }
+};
+
+TEST_F(BacklightSoftware, DutyMatchesEveryLevel) {
+    printf("level  expected  achieved  error\n");
+    for (uint8_t level = 0; level <= BACKLIGHT_LEVELS; level++) {
+        backlight_set(level);
+        double expected = cie1931((double)level / BACKLIGHT_LEVELS);
+        double achieved = measure_duty(CYCLE_TICKS);
+        printf("%5u  %8.5f  %8.5f  %+.5f\n", level, expected, achieved, achieved - expected);
+        // at least 8 bits of effective resolution
+        EXPECT_NEAR(achieved, expected, 1.0 / 256) << "level " << (int)level;
+    }
+}
+
+TEST_F(BacklightSoftware, OffAndFullAreSteady) {
+    backlight_set(0);
+    EXPECT_EQ(measure_duty(1000), 0.0);
+
+    backlight_set(BACKLIGHT_LEVELS);
+    EXPECT_EQ(measure_duty(1000), 1.0);
+    uint32_t writes = mock_pin_writes;
+    measure_duty(1000);
+    EXPECT_EQ(mock_pin_writes, writes);
+}
+
+TEST_F(BacklightSoftware, OnTicksAreSpreadEvenly) {
+    for (uint8_t level = 1; level < BACKLIGHT_LEVELS; level++) {
+        backlight_set(level);
+        double duty = measure_duty(CYCLE_TICKS);
+
+        // The gap between two on-ticks, and the length of each burst, never
+        // exceed what an ideal evenly spaced pattern of the same duty would need
+        uint32_t longest_off = 0, longest_on = 0, run = 0;
+        bool     last        = mock_pins_on;
+        for (uint32_t i = 0; i < CYCLE_TICKS; i++) {
+            backlight_task();
+            run = mock_pins_on == last ? run + 1 : 1;
+            last = mock_pins_on;
+            if (mock_pins_on) {
+                longest_on = run > longest_on ? run : longest_on;
+            } else {
+                longest_off = run > longest_off ? run : longest_off;
+            }
+        }
+        EXPECT_LE(longest_off, (uint32_t)ceil((1.0 - duty) / duty) + 1) << "level " << (int)level;
+        EXPECT_LE(longest_on, (uint32_t)ceil(duty / (1.0 - duty)) + 1) << "level " << (int)level;
+    }
+}
+
+TEST_F(BacklightSoftware, BreathingFollowsTheTable) {
+    const uint32_t period = BREATHING_PERIOD * 1000;
+
+    backlight_set(BACKLIGHT_LEVELS);
+    breathing_enable();
+    ASSERT_TRUE(is_breathing());
+
+    // dark at the start of the breath, full at its peak
+    EXPECT_EQ(measure_duty(4096), 0.0);
+    set_time(period / 2);
+    EXPECT_NEAR(measure_duty(CYCLE_TICKS), 1.0, 1.0 / 256);
+    set_time(period / 4);
+    double quarter = measure_duty(CYCLE_TICKS);
+    EXPECT_GT(quarter, 0.0);
+    EXPECT_LT(quarter, 0.5);
+
+    // the breath repeats every period
+    set_time(period + period / 4);
+    EXPECT_NEAR(measure_duty(CYCLE_TICKS), quarter, 1.0 / 65536);
+}
+
+TEST_F(BacklightSoftware, BreathingScalesWithLevel) {
+    const uint32_t period = BREATHING_PERIOD * 1000;
+
+    breathing_enable();
+    set_time(period / 2);
+
+    mock_backlight_level = BACKLIGHT_LEVELS / 2;
+    backlight_set(mock_backlight_level);
+    double expected = cie1931((double)mock_backlight_level / BACKLIGHT_LEVELS);
+    EXPECT_NEAR(measure_duty(CYCLE_TICKS), expected, 1.0 / 256);
+
+    // stopping the breath goes back to the plain level
+    breathing_disable();
+    EXPECT_FALSE(is_breathing());
+    EXPECT_NEAR(measure_duty(CYCLE_TICKS), expected, 1.0 / 256);
+}
+
+TEST_F(BacklightSoftware, DimmestBreathIsBounded) {
+    const uint32_t period = BREATHING_PERIOD * 1000;
+
+    backlight_set(BACKLIGHT_LEVELS);
+    breathing_enable();
+
+    // the first non-zero step of the table, a duty of 28/65535
+    set_time(period * 11 / 128 + period / 256);
+    uint32_t longest_off = 0, run = 0;
+    for (uint32_t i = 0; i < CYCLE_TICKS; i++) {
+        backlight_task();
+        run         = mock_pins_on ? 0 : run + 1;
+        longest_off = run > longest_off ? run : longest_off;
+    }
+    EXPECT_GT(measure_duty(CYCLE_TICKS), 0.0);
+    EXPECT_LE(longest_off, 100U);
+}
@@ -0,0 +1,7 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define BACKLIGHT_LEVELS 15
+#define BACKLIGHT_BREATHING
+#define BREATHING_PERIOD 2
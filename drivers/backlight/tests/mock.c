@@ -0,0 +1,42 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "backlight.h"
+#include "backlight_driver_common.h"
+#include "mock.h"
+
+bool     mock_pins_on    = false;
+uint32_t mock_pin_writes = 0;
+
+uint8_t mock_backlight_level     = BACKLIGHT_LEVELS;
+bool    mock_backlight_breathing = false;
+
+void backlight_pins_init(void) {
+    mock_pins_on = false;
+}
+
+void backlight_pins_on(void) {
+    mock_pins_on = true;
+    mock_pin_writes++;
+}
+
+void backlight_pins_off(void) {
+    mock_pins_on = false;
+    mock_pin_writes++;
+}
+
+uint8_t get_backlight_level(void) {
+    return mock_backlight_level;
+}
+
+bool is_backlight_enabled(void) {
+    return mock_backlight_level != 0;
+}
+
+bool is_backlight_breathing(void) {
+    return mock_backlight_breathing;
+}
+
+uint8_t get_breathing_period(void) {
+    return BREATHING_PERIOD;
+}
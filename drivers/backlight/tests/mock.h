@@ -0,0 +1,14 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// State of the backlight pins, as last written by the driver
+extern bool     mock_pins_on;
+extern uint32_t mock_pin_writes;
+
+// What the backlight core would report
+extern uint8_t mock_backlight_level;
+extern bool    mock_backlight_breathing;
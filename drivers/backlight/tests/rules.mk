@@ -0,0 +1,11 @@
+backlight_software_DEFS := -DBACKLIGHT_ENABLE
+backlight_software_CONFIG := $(DRIVER_PATH)/backlight/tests/config_mock.h
+
+backlight_software_INC := \
+	$(QUANTUM_PATH)/backlight
+
+backlight_software_SRC := \
+	platforms/test/timer.c \
+	$(DRIVER_PATH)/backlight/tests/mock.c \
+	$(DRIVER_PATH)/backlight/tests/backlight_software_tests.cpp \
+	$(DRIVER_PATH)/backlight/backlight_software.c
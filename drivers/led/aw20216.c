@@ -71,6 +71,9 @@
 uint8_t g_pwm_buffer[DRIVER_COUNT][AW_PWM_REGISTER_COUNT];
 bool    g_pwm_buffer_update_required[DRIVER_COUNT] = {false};
 
+uint8_t g_global_current                               = AW_GLOBAL_CURRENT_MAX;
+bool    g_global_current_update_required[DRIVER_COUNT] = {false};
+
 bool aw20216_write(pin_t cs_pin, uint8_t page, uint8_t reg, uint8_t* data, uint8_t len) {
     static uint8_t s_spi_transfer_buffer[2] = {0};
 
@@ -166,3 +169,22 @@ void aw20216_update_pwm_buffers(pin_t cs_pin, uint8_t index) {
     }
     g_pwm_buffer_update_required[index] = false;
 }
+
+void aw20216_set_global_current(uint8_t value) {
+    // Scale against the configured maximum so full brightness matches init
+    value = (uint16_t)value * AW_GLOBAL_CURRENT_MAX / 255;
+    if (value == g_global_current) {
+        return;
+    }
+    g_global_current = value;
+    for (uint8_t i = 0; i < DRIVER_COUNT; i++) {
+        g_global_current_update_required[i] = true;
+    }
+}
+
+void aw20216_update_global_current(pin_t cs_pin, uint8_t index) {
+    if (g_global_current_update_required[index]) {
+        aw20216_write_register(cs_pin, AW_PAGE_FUNCTION, AW_REG_GLOBALCURRENT, g_global_current);
+    }
+    g_global_current_update_required[index] = false;
+}
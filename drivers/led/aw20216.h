@@ -35,6 +35,11 @@ void aw20216_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
 void aw20216_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 void aw20216_update_pwm_buffers(pin_t cs_pin, uint8_t index);
 
+// Scale every LED in hardware, 0 (off) to 255 (AW_GLOBAL_CURRENT_MAX).
+// Buffered until aw20216_update_global_current() like the PWM registers.
+void aw20216_set_global_current(uint8_t value);
+void aw20216_update_global_current(pin_t cs_pin, uint8_t index);
+
 #define CS1_SW1 0x00
 #define CS2_SW1 0x01
 #define CS3_SW1 0x02
@@ -85,6 +85,11 @@ uint8_t g_twi_transfer_buffer[20];
 uint8_t g_pwm_buffer[DRIVER_COUNT][192];
 bool    g_pwm_buffer_update_required[DRIVER_COUNT] = {false};
 
+// Global current is buffered like the PWM registers so a brightness change
+// reaches the chip in the same flush as the frame it belongs to.
+uint8_t g_global_current                               = ISSI_GLOBALCURRENT;
+bool    g_global_current_update_required[DRIVER_COUNT] = {false};
+
 uint8_t g_led_control_registers[DRIVER_COUNT][24]             = {0};
 bool    g_led_control_registers_update_required[DRIVER_COUNT] = {false};
 
@@ -261,3 +266,25 @@ void is31fl3733_update_led_control_registers(uint8_t addr, uint8_t index) {
     }
     g_led_control_registers_update_required[index] = false;
 }
+
+void is31fl3733_set_global_current(uint8_t value) {
+    // Scale against the configured maximum so full brightness matches init.
+    value = (uint16_t)value * ISSI_GLOBALCURRENT / 255;
+    if (value == g_global_current) {
+        return;
+    }
+    g_global_current = value;
+    for (uint8_t i = 0; i < DRIVER_COUNT; i++) {
+        g_global_current_update_required[i] = true;
+    }
+}
+
+void is31fl3733_update_global_current(uint8_t addr, uint8_t index) {
+    if (g_global_current_update_required[index]) {
+        // unlock the command register and select PG3
+        is31fl3733_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
+        is31fl3733_write_register(addr, ISSI_COMMANDREGISTER, ISSI_PAGE_FUNCTION);
+        is31fl3733_write_register(addr, ISSI_REG_GLOBALCURRENT, g_global_current);
+        g_global_current_update_required[index] = false;
+    }
+}
@@ -48,6 +48,11 @@ void is31fl3733_set_led_control_register(uint8_t index, bool red, bool green, bo
 void is31fl3733_update_pwm_buffers(uint8_t addr, uint8_t index);
 void is31fl3733_update_led_control_registers(uint8_t addr, uint8_t index);
 
+// Scale every LED in hardware, 0 (off) to 255 (ISSI_GLOBALCURRENT).
+// Buffered until is31fl3733_update_global_current() like the PWM registers.
+void is31fl3733_set_global_current(uint8_t value);
+void is31fl3733_update_global_current(uint8_t addr, uint8_t index);
+
 #define PUR_0R 0x00   // No PUR resistor
 #define PUR_05KR 0x02 // 0.5k Ohm resistor in t_NOL
 #define PUR_3KR 0x03  // 3.0k Ohm resistor on all the time
@@ -90,6 +90,11 @@ bool    g_scaling_registers_update_required[DRIVER_COUNT] = {false};
 
 uint8_t g_scaling_registers[DRIVER_COUNT][ISSI_MAX_LEDS];
 
+// Global current is buffered like the PWM registers so a brightness change
+// reaches the chip in the same flush as the frame it belongs to.
+uint8_t g_global_current                               = ISSI_GLOBALCURRENT;
+bool    g_global_current_update_required[DRIVER_COUNT] = {false};
+
 void is31fl3741_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
     g_twi_transfer_buffer[0] = reg;
     g_twi_transfer_buffer[1] = data;
@@ -272,3 +277,25 @@ void is31fl3741_set_scaling_registers(const is31_led *pled, uint8_t red, uint8_t
 
     g_scaling_registers_update_required[pled->driver] = true;
 }
+
+void is31fl3741_set_global_current(uint8_t value) {
+    // Scale against the configured maximum so full brightness matches init.
+    value = (uint16_t)value * ISSI_GLOBALCURRENT / 255;
+    if (value == g_global_current) {
+        return;
+    }
+    g_global_current = value;
+    for (uint8_t i = 0; i < DRIVER_COUNT; i++) {
+        g_global_current_update_required[i] = true;
+    }
+}
+
+void is31fl3741_update_global_current(uint8_t addr, uint8_t index) {
+    if (g_global_current_update_required[index]) {
+        // unlock the command register and select PG4
+        is31fl3741_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
+        is31fl3741_write_register(addr, ISSI_COMMANDREGISTER, ISSI_PAGE_FUNCTION);
+        is31fl3741_write_register(addr, ISSI_REG_GLOBALCURRENT, g_global_current);
+        g_global_current_update_required[index] = false;
+    }
+}
@@ -47,6 +47,11 @@ void is31fl3741_set_led_control_register(uint8_t index, bool red, bool green, bo
 // If the buffer is dirty, it will update the driver with the buffer.
 void is31fl3741_update_pwm_buffers(uint8_t addr, uint8_t index);
 void is31fl3741_update_led_control_registers(uint8_t addr, uint8_t index);
+
+// Scale every LED in hardware, 0 (off) to 255 (ISSI_GLOBALCURRENT).
+// Buffered until is31fl3741_update_global_current() like the PWM registers.
+void is31fl3741_set_global_current(uint8_t value);
+void is31fl3741_update_global_current(uint8_t addr, uint8_t index);
 void is31fl3741_set_scaling_registers(const is31_led *pled, uint8_t red, uint8_t green, uint8_t blue);
 
 void is31fl3741_set_pwm_buffer(const is31_led *pled, uint8_t red, uint8_t green, uint8_t blue);
@@ -0,0 +1,13 @@
+ws2812_spi_encode_SRC := \
+	$(DRIVER_PATH)/led/tests/ws2812_spi_encode_tests.cpp
+
+ws2812_spi_encode_INC := \
+	$(DRIVER_PATH)/led
+
+ws2812_spi_encode_rgbw_DEFS := -DRGBW
+
+ws2812_spi_encode_rgbw_SRC := \
+	$(DRIVER_PATH)/led/tests/ws2812_spi_encode_tests.cpp
+
+ws2812_spi_encode_rgbw_INC := \
+	$(DRIVER_PATH)/led
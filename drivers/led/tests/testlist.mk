@@ -0,0 +1 @@
+TEST_LIST += ws2812_spi_encode ws2812_spi_encode_rgbw
@@ -0,0 +1,126 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "ws2812_spi_encode.h"
+}
+
+// The per bit-pair encoder the SPI driver used before the lookup table
+static uint8_t get_protocol_eq(uint8_t data, int pos) {
+    uint8_t eq = 0;
+    if (data & (1 << (2 * (3 - pos))))
+        eq = 0b1110;
+    else
+        eq = 0b1000;
+    if (data & (2 << (2 * (3 - pos))))
+        eq += 0b11100000;
+    else
+        eq += 0b10000000;
+    return eq;
+}
+
+// Recovers a colour byte from its SPI encoding, failing on malformed bit patterns
+static uint8_t decode_byte(const uint8_t *spi) {
+    uint8_t data = 0;
+    for (uint8_t i = 0; i < WS2812_SPI_BYTES_PER_CHANNEL; i++) {
+        for (uint8_t shift = 4;; shift -= 4) {
+            uint8_t nibble = (spi[i] >> shift) & 0xF;
+            EXPECT_TRUE(nibble == 0b1110 || nibble == 0b1000) << "byte " << (int)i << " nibble " << (int)nibble;
+            data = (data << 1) | (nibble == 0b1110);
+            if (shift == 0) break;
+        }
+    }
+    return data;
+}
+
+TEST(WS2812SpiEncode, EveryByteRoundTrips) {
+    for (uint16_t value = 0; value < 256; value++) {
+        uint8_t spi[WS2812_SPI_BYTES_PER_CHANNEL];
+        ws2812_spi_encode_byte(value, spi);
+        EXPECT_EQ(decode_byte(spi), value);
+    }
+}
+
+TEST(WS2812SpiEncode, MatchesPreviousEncoder) {
+    for (uint16_t value = 0; value < 256; value++) {
+        uint8_t spi[WS2812_SPI_BYTES_PER_CHANNEL];
+        ws2812_spi_encode_byte(value, spi);
+        for (uint8_t j = 0; j < WS2812_SPI_BYTES_PER_CHANNEL; j++) {
+            EXPECT_EQ(spi[j], get_protocol_eq(value, j)) << "value " << value << " byte " << (int)j;
+        }
+    }
+}
+
+TEST(WS2812SpiEncode, KnownPatterns) {
+    uint8_t spi[WS2812_SPI_BYTES_PER_CHANNEL];
+
+    ws2812_spi_encode_byte(0x00, spi);
+    for (uint8_t i = 0; i < WS2812_SPI_BYTES_PER_CHANNEL; i++) {
+        EXPECT_EQ(spi[i], 0x88);
+    }
+
+    ws2812_spi_encode_byte(0xFF, spi);
+    for (uint8_t i = 0; i < WS2812_SPI_BYTES_PER_CHANNEL; i++) {
+        EXPECT_EQ(spi[i], 0xEE);
+    }
+
+    // Most significant bit goes out first
+    ws2812_spi_encode_byte(0x80, spi);
+    EXPECT_EQ(spi[0], 0xE8);
+    EXPECT_EQ(spi[1], 0x88);
+    EXPECT_EQ(spi[3], 0x88);
+
+    ws2812_spi_encode_byte(0x01, spi);
+    EXPECT_EQ(spi[0], 0x88);
+    EXPECT_EQ(spi[3], 0x8E);
+}
+
+TEST(WS2812SpiEncode, LedUsesConfiguredByteOrder) {
+    LED_TYPE led = {0};
+    led.r        = 0x12;
+    led.g        = 0x34;
+    led.b        = 0x56;
+#ifdef RGBW
+    led.w = 0x78;
+#endif
+
+    uint8_t spi[WS2812_SPI_BYTES_PER_LED];
+    ws2812_spi_encode_led(led, spi);
+
+    // WS2812_BYTE_ORDER defaults to GRB
+    EXPECT_EQ(decode_byte(&spi[0]), 0x34);
+    EXPECT_EQ(decode_byte(&spi[WS2812_SPI_BYTES_PER_CHANNEL]), 0x12);
+    EXPECT_EQ(decode_byte(&spi[WS2812_SPI_BYTES_PER_CHANNEL * 2]), 0x56);
+#ifdef RGBW
+    EXPECT_EQ(decode_byte(&spi[WS2812_SPI_BYTES_PER_CHANNEL * 3]), 0x78);
+#endif
+}
+
+TEST(WS2812SpiEncode, FrameStaysWithinItsLeds) {
+    LED_TYPE leds[5];
+    memset(leds, 0, sizeof(leds));
+    for (uint8_t i = 0; i < 5; i++) {
+        leds[i].r = i * 50;
+        leds[i].g = 255 - i;
+        leds[i].b = i * 7;
+#ifdef RGBW
+        leds[i].w = i;
+#endif
+    }
+
+    uint8_t frame[WS2812_SPI_BYTES_PER_LED * 6];
+    memset(frame, 0x55, sizeof(frame));
+    ws2812_spi_encode_leds(leds, 5, frame);
+
+    for (uint8_t i = 0; i < 5; i++) {
+        uint8_t expected[WS2812_SPI_BYTES_PER_LED];
+        ws2812_spi_encode_led(leds[i], expected);
+        EXPECT_EQ(memcmp(&frame[WS2812_SPI_BYTES_PER_LED * i], expected, WS2812_SPI_BYTES_PER_LED), 0) << "led " << (int)i;
+    }
+    for (uint8_t i = WS2812_SPI_BYTES_PER_LED * 5; i < sizeof(frame); i++) {
+        EXPECT_EQ(frame[i], 0x55);
+    }
+}
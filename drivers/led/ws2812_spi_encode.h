@@ -0,0 +1,63 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "color.h"
+
+/*
+ * The SPI WS2812 driver clocks the data line at ~3.2MHz, so every WS2812 bit
+ * becomes 4 SPI bits: 0b1110 for a 1 and 0b1000 for a 0. Each colour byte
+ * therefore takes 4 SPI bytes, most significant bit first.
+ */
+#define WS2812_SPI_BYTES_PER_CHANNEL 4
+#ifdef RGBW
+#    define WS2812_SPI_CHANNELS 4
+#else
+#    define WS2812_SPI_CHANNELS 3
+#endif
+#define WS2812_SPI_BYTES_PER_LED (WS2812_SPI_BYTES_PER_CHANNEL * WS2812_SPI_CHANNELS)
+
+// SPI bytes for every nibble of a colour byte, two WS2812 bits per SPI byte
+static const uint8_t ws2812_spi_nibble_table[16][2] = {
+    {0x88, 0x88}, {0x88, 0x8E}, {0x88, 0xE8}, {0x88, 0xEE}, //
+    {0x8E, 0x88}, {0x8E, 0x8E}, {0x8E, 0xE8}, {0x8E, 0xEE}, //
+    {0xE8, 0x88}, {0xE8, 0x8E}, {0xE8, 0xE8}, {0xE8, 0xEE}, //
+    {0xEE, 0x88}, {0xEE, 0x8E}, {0xEE, 0xE8}, {0xEE, 0xEE}, //
+};
+
+static inline void ws2812_spi_encode_byte(uint8_t data, uint8_t *out) {
+    const uint8_t *high = ws2812_spi_nibble_table[data >> 4];
+    const uint8_t *low  = ws2812_spi_nibble_table[data & 0xF];
+    out[0]              = high[0];
+    out[1]              = high[1];
+    out[2]              = low[0];
+    out[3]              = low[1];
+}
+
+// Writes WS2812_SPI_BYTES_PER_LED bytes for one LED, in the configured byte order
+static inline void ws2812_spi_encode_led(LED_TYPE color, uint8_t *out) {
+#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
+    ws2812_spi_encode_byte(color.g, &out[0]);
+    ws2812_spi_encode_byte(color.r, &out[WS2812_SPI_BYTES_PER_CHANNEL]);
+    ws2812_spi_encode_byte(color.b, &out[WS2812_SPI_BYTES_PER_CHANNEL * 2]);
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
+    ws2812_spi_encode_byte(color.r, &out[0]);
+    ws2812_spi_encode_byte(color.g, &out[WS2812_SPI_BYTES_PER_CHANNEL]);
+    ws2812_spi_encode_byte(color.b, &out[WS2812_SPI_BYTES_PER_CHANNEL * 2]);
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
+    ws2812_spi_encode_byte(color.b, &out[0]);
+    ws2812_spi_encode_byte(color.g, &out[WS2812_SPI_BYTES_PER_CHANNEL]);
+    ws2812_spi_encode_byte(color.r, &out[WS2812_SPI_BYTES_PER_CHANNEL * 2]);
+#endif
+#ifdef RGBW
+    ws2812_spi_encode_byte(color.w, &out[WS2812_SPI_BYTES_PER_CHANNEL * 3]);
+#endif
+}
+
+static inline void ws2812_spi_encode_leds(const LED_TYPE *leds, uint16_t count, uint8_t *out) {
+    for (uint16_t i = 0; i < count; i++) {
+        ws2812_spi_encode_led(leds[i], &out[WS2812_SPI_BYTES_PER_LED * i]);
+    }
+}
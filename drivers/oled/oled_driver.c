@@ -24,6 +24,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    endif
 #endif
 #include "oled_driver.h"
+#include "oled_rotate.h"
 #include OLED_FONT_H
 #include "timer.h"
 #include "print.h"
@@ -165,6 +166,16 @@ uint32_t oled_scroll_timeout;
 #if OLED_UPDATE_INTERVAL > 0
 uint16_t oled_update_timeout;
 #endif
+#ifdef OLED_ASYNC_FLUSH
+// Whether a block transfer started by oled_render() may still be running
+static bool oled_async_pending = false;
+#endif
+#ifdef OLED_SHADOW_BUFFER
+// What was last sent to the panel, for skipping blocks that were rewritten
+// with identical content. Blocks are only compared once their bit is valid.
+static uint8_t         oled_shadow[OLED_MATRIX_SIZE];
+static OLED_BLOCK_TYPE oled_shadow_valid = 0;
+#endif
 
 #if defined(OLED_TRANSPORT_SPI)
 #    ifndef OLED_DC_PIN
@@ -185,8 +196,27 @@ uint16_t oled_update_timeout;
 #    endif
 #endif
 
+#ifdef OLED_ASYNC_FLUSH
+__attribute__((weak)) bool oled_send_data_async(const uint8_t *data, uint16_t size) {
+    return oled_send_data(data, size);
+}
+
+__attribute__((weak)) bool oled_send_data_busy(void) {
+    return false;
+}
+
+// Commands must not interleave with a block transfer still in flight
+static inline void oled_async_wait(void) {
+    while (oled_async_pending && oled_send_data_busy()) {
+    }
+}
+#endif
+
 // Transmit/Write Funcs.
 __attribute__((weak)) bool oled_send_cmd(const uint8_t *data, uint16_t size) {
+#ifdef OLED_ASYNC_FLUSH
+    oled_async_wait();
+#endif
 #if defined(OLED_TRANSPORT_SPI)
     if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
         return false;
@@ -208,6 +238,9 @@ __attribute__((weak)) bool oled_send_cmd(const uint8_t *data, uint16_t size) {
 }
 
 __attribute__((weak)) bool oled_send_cmd_P(const uint8_t *data, uint16_t size) {
+#ifdef OLED_ASYNC_FLUSH
+    oled_async_wait();
+#endif
 #if defined(__AVR__)
 #    if defined(OLED_TRANSPORT_SPI)
     if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
@@ -367,6 +400,11 @@ bool oled_init(oled_rotation_t rotation) {
     oled_scroll_timeout = timer_read32() + OLED_SCROLL_TIMEOUT;
 #endif
 
+#ifdef OLED_SHADOW_BUFFER
+    // Panel contents are unknown after power up
+    oled_shadow_valid = 0;
+#endif
+
     oled_clear();
     oled_initialized = true;
     oled_active      = true;
@@ -387,10 +425,11 @@ void oled_clear(void) {
     oled_dirty  = OLED_ALL_BLOCKS_MASK;
 }
 
-static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
+static void calc_bounds(uint8_t update_start, uint16_t span_start, uint16_t span_length, uint8_t *cmd_array) {
     // Calculate commands to set memory addressing bounds.
+    // The span narrows the update to part of the block, and is only used when the block lies within a single page.
     uint8_t start_page   = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_WIDTH;
-    uint8_t start_column = OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_WIDTH;
+    uint8_t start_column = OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_WIDTH + span_start;
 #if !OLED_IC_HAS_HORIZONTAL_MODE
     // Commands for Page Addressing Mode. Sets starting page and column; has no end bound.
     // Column value must be split into high and low nybble and sent as two commands.
@@ -401,8 +440,8 @@ static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
     // Commands for use in Horizontal Addressing mode.
     cmd_array[1] = start_column + OLED_COLUMN_OFFSET;
     cmd_array[4] = start_page;
-    cmd_array[2] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) % OLED_DISPLAY_WIDTH + cmd_array[1];
-    cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1 + cmd_array[4];
+    cmd_array[2] = (span_length + OLED_DISPLAY_WIDTH - 1) % OLED_DISPLAY_WIDTH + cmd_array[1];
+    cmd_array[5] = (span_length + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1 + cmd_array[4];
 #endif
 }
 
@@ -442,16 +481,49 @@ uint8_t crot(uint8_t a, int8_t n) {
     return a << n | a >> (-n & mask);
 }
 
-static void rotate_90(const uint8_t *src, uint8_t *dest) {
-    for (uint8_t i = 0, shift = 7; i < 8; ++i, --shift) {
-        uint8_t selector = (1 << i);
-        for (uint8_t j = 0; j < 8; ++j) {
-            dest[i] |= crot(src[j] & selector, shift - (int8_t)j);
-        }
+#ifdef OLED_ASYNC_FLUSH
+__attribute__((weak)) void oled_render_complete_kb(void) {
+    oled_render_complete_user();
+}
+
+__attribute__((weak)) void oled_render_complete_user(void) {}
+
+// Returns true while the previous block transfer is still running
+static bool oled_async_poll(void) {
+    if (!oled_async_pending) {
+        return false;
     }
+    if (oled_send_data_busy()) {
+        return true;
+    }
+    oled_async_pending = false;
+    if (!(oled_dirty & OLED_ALL_BLOCKS_MASK)) {
+        oled_render_complete_kb();
+    }
+    return false;
+}
+#    define OLED_RENDER_LIMIT 1
+#else
+#    define OLED_RENDER_LIMIT OLED_UPDATE_PROCESS_LIMIT
+#endif
+
+// Sends a chunk of a block, handing it off to the transport without waiting when flushing asynchronously
+static bool oled_send_render_data(const uint8_t *data, uint16_t size) {
+#ifdef OLED_ASYNC_FLUSH
+    oled_async_pending = oled_send_data_async(data, size);
+    return oled_async_pending;
+#else
+    return oled_send_data(data, size);
+#endif
 }
 
 void oled_render(void) {
+#ifdef OLED_ASYNC_FLUSH
+    if (oled_async_poll()) {
+        return;
+    }
+#endif
+
     // Do we have work to do?
     oled_dirty &= OLED_ALL_BLOCKS_MASK;
     if (!oled_dirty || !oled_initialized || oled_scrolling) {
@@ -463,12 +535,39 @@ void oled_render(void) {
 
     uint8_t update_start  = 0;
     uint8_t num_processed = 0;
-    while (oled_dirty && num_processed++ < OLED_UPDATE_PROCESS_LIMIT) { // render all dirty blocks (up to the configured limit)
+    while (oled_dirty && num_processed++ < OLED_RENDER_LIMIT) { // render all dirty blocks (up to the configured limit)
         // Find next dirty block
         while (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << update_start))) {
             ++update_start;
         }
 
+        // Range of bytes within the block to send
+        uint16_t span_start = 0;
+        uint16_t span_end   = OLED_BLOCK_SIZE;
+#ifdef OLED_SHADOW_BUFFER
+        const uint8_t *block  = &oled_buffer[OLED_BLOCK_SIZE * update_start];
+        uint8_t       *shadow = &oled_shadow[OLED_BLOCK_SIZE * update_start];
+        if (oled_shadow_valid & ((OLED_BLOCK_TYPE)1 << update_start)) {
+            while (span_start < OLED_BLOCK_SIZE && block[span_start] == shadow[span_start]) {
+                ++span_start;
+            }
+            if (span_start == OLED_BLOCK_SIZE) {
+                // Rewritten with what the panel already shows, skip it without counting towards the limit
+                oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+                --num_processed;
+                continue;
+            }
+            while (block[span_end - 1] == shadow[span_end - 1]) {
+                --span_end;
+            }
+        }
+        // Only blocks within a single page can be narrowed, rotated blocks are always sent whole
+        if (HAS_FLAGS(oled_rotation, OLED_ROTATION_90) || OLED_BLOCK_SIZE > OLED_DISPLAY_WIDTH || OLED_DISPLAY_WIDTH % OLED_BLOCK_SIZE != 0) {
+            span_start = 0;
+            span_end   = OLED_BLOCK_SIZE;
+        }
+#endif
+
         // Set column & page position
 #if OLED_IC_HAS_HORIZONTAL_MODE
         static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
@@ -476,7 +575,7 @@ void oled_render(void) {
         static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
 #endif
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
+            calc_bounds(update_start, span_start, span_end - span_start, &display_start[1]); // Offset from I2C_CMD byte at the start
         } else {
             calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
         }
@@ -487,9 +586,17 @@ void oled_render(void) {
             return;
         }
 
+        static uint8_t temp_buffer[OLED_BLOCK_SIZE];
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+#ifdef OLED_ASYNC_FLUSH
+            // The transfer outlives this call and oled_buffer may be redrawn before it finishes, so send a copy
+            memcpy(temp_buffer, &oled_buffer[OLED_BLOCK_SIZE * update_start + span_start], span_end - span_start);
+            const uint8_t *render_data = temp_buffer;
+#else
+            const uint8_t *render_data = &oled_buffer[OLED_BLOCK_SIZE * update_start + span_start];
+#endif
             // Send render data chunk as is
-            if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
+            if (!oled_send_render_data(render_data, span_end - span_start)) {
                 print("oled_render data failed\n");
                 return;
             }
@@ -498,15 +605,14 @@ void oled_render(void) {
             const static uint8_t source_map[] = OLED_SOURCE_MAP;
             const static uint8_t target_map[] = OLED_TARGET_MAP;
 
-            static uint8_t temp_buffer[OLED_BLOCK_SIZE];
             memset(temp_buffer, 0, sizeof(temp_buffer));
             for (uint8_t i = 0; i < sizeof(source_map); ++i) {
-                rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
+                oled_rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
             }
 
 #if OLED_IC_HAS_HORIZONTAL_MODE
             // Send render data chunk after rotating
-            if (!oled_send_data(&temp_buffer[0], OLED_BLOCK_SIZE)) {
+            if (!oled_send_render_data(&temp_buffer[0], OLED_BLOCK_SIZE)) {
                 print("oled_render90 data failed\n");
                 return;
             }
@@ -532,9 +638,21 @@ void oled_render(void) {
 #endif
         }
 
+#ifdef OLED_SHADOW_BUFFER
+        memcpy(&shadow[span_start], &block[span_start], span_end - span_start);
+        oled_shadow_valid |= ((OLED_BLOCK_TYPE)1 << update_start);
+#endif
+
         // Clear dirty flag of just rendered block
         oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
     }
+
+#ifdef OLED_ASYNC_FLUSH
+    // Everything was sent or skipped without leaving a transfer running
+    if (!oled_async_pending && !oled_dirty) {
+        oled_render_complete_kb();
+    }
+#endif
 }
 
 void oled_set_cursor(uint8_t col, uint8_t line) {
@@ -711,6 +829,75 @@ void oled_write_pixel(uint8_t x, uint8_t y, bool on) {
     }
 }
 
+// Copies a 1bpp bitmap into the buffer at any pixel position, clipping to the display.
+// Each source column byte is shifted into a word that straddles two buffer pages, so
+// every destination byte is written once rather than pixel by pixel.
+static void oled_blit(int16_t x, int16_t y, const uint8_t *data, uint8_t width, uint8_t height, bool invert, bool progmem) {
+    const int16_t buffer_pages = OLED_MATRIX_SIZE / oled_rotation_width;
+    const int16_t page         = y >= 0 ? y / 8 : -((7 - y) / 8);
+    const uint8_t shift        = y - page * 8;
+
+    int16_t col_start = x < 0 ? -x : 0;
+    int16_t col_end   = width;
+    if (x + col_end > oled_rotation_width) {
+        col_end = oled_rotation_width - x;
+    }
+
+    for (uint8_t src_page = 0; src_page < (height + 7) / 8; src_page++) {
+        int16_t  dest_page = page + src_page;
+        uint8_t  rows      = height - src_page * 8;
+        uint16_t mask      = (rows >= 8 ? 0xFF : (1 << rows) - 1) << shift;
+        if (dest_page + 1 < 0 || dest_page >= buffer_pages) {
+            continue;
+        }
+
+        const uint8_t *src = &data[src_page * width];
+        for (int16_t col = col_start; col < col_end; col++) {
+            uint8_t bits = progmem ? pgm_read_byte(&src[col]) : src[col];
+            if (invert) {
+                bits = ~bits;
+            }
+            uint16_t word = (uint16_t)bits << shift;
+
+            for (uint8_t half = 0; half < 2; half++) {
+                int16_t dest_row  = dest_page + half;
+                uint8_t dest_mask = mask >> (half * 8);
+                if (!dest_mask || dest_row < 0 || dest_row >= buffer_pages) {
+                    continue;
+                }
+                uint16_t index = dest_row * oled_rotation_width + x + col;
+                uint8_t  value = (oled_buffer[index] & ~dest_mask) | ((word >> (half * 8)) & dest_mask);
+                if (oled_buffer[index] != value) {
+                    oled_buffer[index] = value;
+                    oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+                }
+            }
+        }
+    }
+}
+
+void oled_write_bitmap(int16_t x, int16_t y, const uint8_t *data, uint8_t width, uint8_t height, bool invert) {
+    oled_blit(x, y, data, width, height, invert, false);
+}
+
+void oled_write_char_at(int16_t x, int16_t y, const char data, bool invert) {
+    static const uint8_t blank[OLED_FONT_WIDTH] = {0};
+
+    uint8_t cast_data = (uint8_t)data;
+    if (cast_data < OLED_FONT_START || cast_data > OLED_FONT_END) {
+        oled_blit(x, y, blank, OLED_FONT_WIDTH, 8, invert, false);
+    } else {
+        oled_blit(x, y, &font[(cast_data - OLED_FONT_START) * OLED_FONT_WIDTH], OLED_FONT_WIDTH, 8, invert, true);
+    }
+}
+
+void oled_write_at(int16_t x, int16_t y, const char *data, bool invert) {
+    while (*data && x < oled_rotation_width) {
+        oled_write_char_at(x, y, *data++, invert);
+        x += OLED_FONT_WIDTH;
+    }
+}
+
 #if defined(__AVR__)
 void oled_write_P(const char *data, bool invert) {
     uint8_t c = pgm_read_byte(data);
@@ -735,6 +922,10 @@ void oled_write_raw_P(const char *data, uint16_t size) {
         oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
     }
 }
+
+void oled_write_bitmap_P(int16_t x, int16_t y, const uint8_t *data, uint8_t width, uint8_t height, bool invert) {
+    oled_blit(x, y, data, width, height, invert, true);
+}
 #endif // defined(__AVR__)
 
 bool oled_on(void) {
@@ -883,6 +1074,10 @@ bool oled_scroll_off(void) {
         }
         oled_scrolling = false;
         oled_dirty     = OLED_ALL_BLOCKS_MASK;
+#ifdef OLED_SHADOW_BUFFER
+        // Scrolling moved the panel contents around
+        oled_shadow_valid = 0;
+#endif
     }
     return !oled_scrolling;
 }
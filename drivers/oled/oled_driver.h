@@ -344,6 +344,17 @@ bool oled_send_cmd_P(const uint8_t *data, uint16_t size);
 bool oled_send_data(const uint8_t *data, uint16_t size);
 void oled_driver_init(void);
 
+#ifdef OLED_ASYNC_FLUSH
+// Starts sending render data without waiting for it to finish, the data stays untouched until oled_send_data_busy() returns false.
+// Weak functions overridable by transports that can send in the background, the defaults send synchronously
+bool oled_send_data_async(const uint8_t *data, uint16_t size);
+bool oled_send_data_busy(void);
+
+// Called once all dirty blocks have been sent to the display, weak function overridable by the user
+void oled_render_complete_kb(void);
+void oled_render_complete_user(void);
+#endif
+
 // Called at the start of oled_init, weak function overridable by the user
 // rotation - the value passed into oled_init
 // Return new oled_rotation_t if you want to override default rotation
@@ -401,6 +412,17 @@ void oled_write_raw_byte(const char data, uint16_t index);
 // Coordinates start at top-left and go right and down for positive x and y
 void oled_write_pixel(uint8_t x, uint8_t y, bool on);
 
+// Writes a 1bpp bitmap with its top-left corner at any pixel position, clipped to the display
+// Data is laid out like the buffer: width column bytes per 8 pixel row, least significant bit at the top
+// Pixels inside the bitmap are replaced, inverts the pixels if true
+void oled_write_bitmap(int16_t x, int16_t y, const uint8_t *data, uint8_t width, uint8_t height, bool invert);
+
+// Writes a single character with its top-left corner at any pixel position, without moving the cursor
+void oled_write_char_at(int16_t x, int16_t y, const char data, bool invert);
+
+// Writes a string starting at any pixel position, without moving the cursor or wrapping
+void oled_write_at(int16_t x, int16_t y, const char *data, bool invert);
+
 #if defined(__AVR__)
 // Writes a PROGMEM string to the buffer at current cursor position
 // Advances the cursor while writing, inverts the pixels if true
@@ -415,10 +437,14 @@ void oled_write_ln_P(const char *data, bool invert);
 
 // Writes a PROGMEM string to the buffer at current cursor position
 void oled_write_raw_P(const char *data, uint16_t size);
+
+// Writes a PROGMEM bitmap at any pixel position
+void oled_write_bitmap_P(int16_t x, int16_t y, const uint8_t *data, uint8_t width, uint8_t height, bool invert);
 #else
 #    define oled_write_P(data, invert) oled_write(data, invert)
 #    define oled_write_ln_P(data, invert) oled_write_ln(data, invert)
 #    define oled_write_raw_P(data, size) oled_write_raw(data, size)
+#    define oled_write_bitmap_P(x, y, data, width, height, invert) oled_write_bitmap(x, y, data, width, height, invert)
 #endif // defined(__AVR__)
 
 // Can be used to manually turn on the screen if it is off
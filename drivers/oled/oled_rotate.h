@@ -0,0 +1,42 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/* Rotates an 8x8 pixel tile by 90 degrees, so that bit `i` of `src[j]` ends
+ * up as bit `7 - j` of `dest[i]`. The result is OR'ed into `dest`.
+ *
+ * This is the shift and mask transpose from Hacker's Delight, working on the
+ * tile as two 32-bit words rather than one bit at a time.
+ */
+static inline void oled_rotate_90(const uint8_t *src, uint8_t *dest) {
+    uint32_t x = ((uint32_t)src[0] << 24) | ((uint32_t)src[1] << 16) | ((uint32_t)src[2] << 8) | src[3];
+    uint32_t y = ((uint32_t)src[4] << 24) | ((uint32_t)src[5] << 16) | ((uint32_t)src[6] << 8) | src[7];
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    // The transpose yields the rows in reverse order
+    dest[0] |= y;
+    dest[1] |= y >> 8;
+    dest[2] |= y >> 16;
+    dest[3] |= y >> 24;
+    dest[4] |= x;
+    dest[5] |= x >> 8;
+    dest[6] |= x >> 16;
+    dest[7] |= x >> 24;
+}
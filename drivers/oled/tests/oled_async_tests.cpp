@@ -0,0 +1,127 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "oled_driver.h"
+#include "oled_mock.h"
+}
+
+class OledAsync : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        oled_mock_reset(0);
+        oled_init(OLED_ROTATION_0);
+        render_all();
+    }
+
+    // Renders until every block has been sent, returning how many oled_render() calls it took
+    uint16_t render_all(void) {
+        uint16_t calls = 0;
+        while (oled_mock.completions == 0 && calls < 1000) {
+            oled_render();
+            calls++;
+        }
+        return calls;
+    }
+};
+
+TEST_F(OledAsync, SendsBlocksInOrderOneAtATime) {
+    oled_mock_reset(3);
+    oled_clear();
+
+    render_all();
+
+    ASSERT_EQ(oled_mock.transfer_count, OLED_BLOCK_COUNT);
+    for (uint8_t i = 0; i < OLED_BLOCK_COUNT; i++) {
+        EXPECT_EQ(oled_mock.transfers[i].block, i);
+        EXPECT_EQ(oled_mock.transfers[i].size, OLED_BLOCK_SIZE);
+    }
+    EXPECT_EQ(oled_mock.completions, 1);
+}
+
+TEST_F(OledAsync, RenderReturnsWhileTransferIsBusy) {
+    oled_mock_reset(5);
+    oled_clear();
+
+    oled_render();
+    ASSERT_EQ(oled_mock.transfer_count, 1);
+    for (uint8_t i = 0; i < 5; i++) {
+        oled_render();
+        EXPECT_EQ(oled_mock.transfer_count, 1);
+    }
+
+    // Busy polls are exhausted, the next block can go
+    oled_render();
+    EXPECT_EQ(oled_mock.transfer_count, 2);
+}
+
+TEST_F(OledAsync, RenderDataIsNotSentBlocking) {
+    oled_mock_reset(2);
+    oled_clear();
+
+    render_all();
+
+    // Only the bounds commands block the caller, the render data goes out in the background
+    EXPECT_EQ(oled_mock.background_bytes, OLED_MATRIX_SIZE);
+    EXPECT_LT(oled_mock.blocking_bytes, oled_mock.background_bytes);
+}
+
+TEST_F(OledAsync, CommandsWaitForPendingTransfer) {
+    oled_mock_reset(10);
+    oled_clear();
+
+    oled_render();
+    ASSERT_EQ(oled_mock.busy_remaining, 10);
+
+    oled_set_brightness(0x40);
+    EXPECT_EQ(oled_mock.busy_remaining, 0);
+}
+
+TEST_F(OledAsync, CompletionFiresOncePerFrame) {
+    oled_mock_reset(1);
+    oled_clear();
+
+    render_all();
+    EXPECT_EQ(oled_mock.completions, 1);
+
+    // Nothing dirty, nothing more to report
+    for (uint8_t i = 0; i < 10; i++) {
+        oled_render();
+    }
+    EXPECT_EQ(oled_mock.completions, 1);
+
+    oled_write_char('A', false);
+    uint16_t calls = 0;
+    while (oled_mock.completions == 1 && calls++ < 100) {
+        oled_render();
+    }
+    EXPECT_EQ(oled_mock.completions, 2);
+}
+
+TEST_F(OledAsync, BufferCanBeRedrawnDuringTransfer) {
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i++) {
+        oled_write_raw_byte(0xAA, i);
+    }
+    uint8_t transfers    = oled_mock.transfer_count;
+    oled_mock.busy_polls = 5;
+    oled_render();
+    ASSERT_EQ(oled_mock.transfer_count, transfers + 1);
+
+    // The user task redraws everything while the first block is still on the bus
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i++) {
+        oled_write_raw_byte(0x55, i);
+    }
+    while (oled_send_data_busy()) {
+    }
+    for (uint16_t i = 0; i < OLED_BLOCK_SIZE; i++) {
+        EXPECT_EQ(oled_mock.panel[i], 0xAA) << "byte " << i;
+    }
+
+    oled_mock.completions = 0;
+    render_all();
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i++) {
+        EXPECT_EQ(oled_mock.panel[i], 0x55) << "byte " << i;
+    }
+}
@@ -0,0 +1,118 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdlib.h>
+#include <string.h>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "oled_driver.h"
+#include "oled_mock.h"
+}
+
+#define OLED_TEST_ROWS (OLED_MATRIX_SIZE / OLED_DISPLAY_WIDTH * 8)
+
+class OledBlit : public ::testing::Test {
+   protected:
+    uint8_t expected[OLED_MATRIX_SIZE];
+
+    void SetUp() override {
+        oled_mock_reset(0);
+        oled_init(OLED_ROTATION_0);
+        fill_random();
+    }
+
+    void fill_random(void) {
+        oled_buffer_reader_t reader = oled_read_raw(0);
+        for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i++) {
+            oled_write_raw_byte(rand(), i);
+        }
+        memcpy(expected, reader.current_element, OLED_MATRIX_SIZE);
+    }
+
+    // Per pixel version of oled_write_bitmap(), applied to the expected buffer
+    void reference_bitmap(int16_t x, int16_t y, const uint8_t *data, uint8_t width, uint8_t height, bool invert) {
+        for (int16_t row = 0; row < height; row++) {
+            for (int16_t col = 0; col < width; col++) {
+                int16_t px = x + col, py = y + row;
+                if (px < 0 || px >= OLED_DISPLAY_WIDTH || py < 0 || py >= OLED_TEST_ROWS) {
+                    continue;
+                }
+                bool     on    = ((data[(row / 8) * width + col] >> (row % 8)) & 1) != invert;
+                uint16_t index = (py / 8) * OLED_DISPLAY_WIDTH + px;
+                if (on) {
+                    expected[index] |= 1 << (py % 8);
+                } else {
+                    expected[index] &= ~(1 << (py % 8));
+                }
+            }
+        }
+    }
+
+    void render_all(void) {
+        for (uint8_t i = 0; i < OLED_BLOCK_COUNT; i++) {
+            oled_render();
+        }
+    }
+
+    void expect_buffer(void) {
+        oled_buffer_reader_t reader = oled_read_raw(0);
+        ASSERT_EQ(memcmp(expected, reader.current_element, OLED_MATRIX_SIZE), 0);
+    }
+};
+
+TEST_F(OledBlit, MatchesPerPixelAtEveryOffset) {
+    uint8_t bitmap[3 * 13];
+    for (uint8_t i = 0; i < sizeof(bitmap); i++) {
+        bitmap[i] = rand();
+    }
+
+    for (int16_t y = -24; y < OLED_TEST_ROWS + 4; y += 3) {
+        for (int16_t x = -15; x < OLED_DISPLAY_WIDTH + 2; x += 7) {
+            for (uint8_t height = 1; height <= 24; height += 5) {
+                bool invert = (x + y) & 1;
+                oled_write_bitmap(x, y, bitmap, 13, height, invert);
+                reference_bitmap(x, y, bitmap, 13, height, invert);
+                expect_buffer();
+            }
+        }
+    }
+}
+
+TEST_F(OledBlit, OnlyChangedBlocksAreDirty) {
+    render_all();
+    const uint8_t bitmap[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+
+    // Four columns straddling pages 0 and 1, within the first block of each page
+    oled_write_bitmap(0, 4, bitmap, 4, 8, false);
+
+    oled_mock_reset(0);
+    render_all();
+    ASSERT_EQ(oled_mock.transfer_count, 2);
+    EXPECT_EQ(oled_mock.transfers[0].block, 0);
+    EXPECT_EQ(oled_mock.transfers[1].block, OLED_DISPLAY_WIDTH / OLED_BLOCK_SIZE);
+}
+
+TEST_F(OledBlit, CharacterOnPageGridMatchesWriteChar) {
+    oled_set_cursor(2, 1);
+    oled_write_char('Q', true);
+    uint8_t grid[OLED_FONT_WIDTH];
+    memcpy(grid, &oled_read_raw(OLED_DISPLAY_WIDTH + 2 * OLED_FONT_WIDTH).current_element[0], OLED_FONT_WIDTH);
+
+    fill_random();
+    oled_write_char_at(2 * OLED_FONT_WIDTH, 8, 'Q', true);
+    EXPECT_EQ(memcmp(grid, oled_read_raw(OLED_DISPLAY_WIDTH + 2 * OLED_FONT_WIDTH).current_element, OLED_FONT_WIDTH), 0);
+}
+
+TEST_F(OledBlit, StringIsClippedAtDisplayEdge) {
+    oled_write_at(OLED_DISPLAY_WIDTH - OLED_FONT_WIDTH - 2, 3, "QMK", false);
+
+    // Columns past the right edge must not spill onto the start of the following page
+    oled_buffer_reader_t reader = oled_read_raw(0);
+    for (uint8_t page = 1; page < OLED_MATRIX_SIZE / OLED_DISPLAY_WIDTH; page++) {
+        for (uint8_t col = 0; col < 2 * OLED_FONT_WIDTH; col++) {
+            uint16_t index = page * OLED_DISPLAY_WIDTH + col;
+            EXPECT_EQ(reader.current_element[index], expected[index]);
+        }
+    }
+}
@@ -0,0 +1,103 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "oled_mock.h"
+#include "oled_driver.h"
+#include "i2c_master.h"
+#include "timer.h"
+
+oled_mock_t oled_mock;
+
+void oled_mock_reset(uint16_t busy_polls) {
+    memset(&oled_mock, 0, sizeof(oled_mock));
+    oled_mock.busy_polls = busy_polls;
+}
+
+static void oled_mock_record(uint16_t size) {
+    oled_mock.data_bytes += size;
+    if (oled_mock.transfer_count < OLED_MOCK_MAX_TRANSFERS) {
+        oled_mock_transfer_t *transfer = &oled_mock.transfers[oled_mock.transfer_count++];
+        transfer->block                = oled_mock.last_block;
+        transfer->size                 = size;
+        transfer->start_ms             = timer_read32();
+    }
+}
+
+// Writes render data into the panel memory the way the controller advances its address
+static void oled_mock_write_panel(const uint8_t *data, uint16_t size) {
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t index = oled_mock.page * OLED_DISPLAY_WIDTH + oled_mock.column;
+        if (oled_mock.column < OLED_DISPLAY_WIDTH && index < OLED_MATRIX_SIZE) {
+            oled_mock.panel[index] = data[i];
+        }
+        oled_mock.column++;
+        if (oled_mock.horizontal_mode && oled_mock.column > oled_mock.column_end) {
+            oled_mock.column = oled_mock.column_start;
+            oled_mock.page   = oled_mock.page < oled_mock.page_end ? oled_mock.page + 1 : oled_mock.page_start;
+        }
+    }
+}
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    if (length == 7 && data[1] == 0x21) {
+        // Horizontal addressing bounds: I2C_CMD, COLUMN_ADDR, start, end, PAGE_ADDR, start, end
+        oled_mock.last_block      = (data[5] * OLED_DISPLAY_WIDTH + data[2]) / OLED_BLOCK_SIZE;
+        oled_mock.horizontal_mode = true;
+        oled_mock.column_start    = data[2] - OLED_COLUMN_OFFSET;
+        oled_mock.column_end      = data[3] - OLED_COLUMN_OFFSET;
+        oled_mock.page_start      = data[5];
+        oled_mock.page_end        = data[6];
+        oled_mock.column          = oled_mock.column_start;
+        oled_mock.page            = oled_mock.page_start;
+    } else if (length == 4 && (data[1] & 0xF0) == 0xB0) {
+        // Page addressing position: I2C_CMD, PAM_PAGE_ADDR | page, column low nybble, column high nybble
+        oled_mock.horizontal_mode = false;
+        oled_mock.page            = data[1] & 0x0F;
+        oled_mock.column          = ((data[2] & 0x0F) | (data[3] & 0x0F) << 4) - OLED_COLUMN_OFFSET;
+        oled_mock.last_block      = (oled_mock.page * OLED_DISPLAY_WIDTH + oled_mock.column) / OLED_BLOCK_SIZE;
+    }
+    oled_mock.blocking_bytes += length;
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_writeReg(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    oled_mock_record(length);
+    oled_mock_write_panel(data, length);
+    oled_mock.blocking_bytes += length;
+    return I2C_STATUS_SUCCESS;
+}
+
+#ifdef OLED_ASYNC_FLUSH
+// Like a DMA transfer, the data is only read once the transfer is over
+bool oled_send_data_async(const uint8_t *data, uint16_t size) {
+    oled_mock_record(size);
+    oled_mock.background_bytes += size;
+    oled_mock.busy_remaining = oled_mock.busy_polls;
+    if (oled_mock.busy_remaining) {
+        oled_mock.pending_data = data;
+        oled_mock.pending_size = size;
+    } else {
+        oled_mock_write_panel(data, size);
+    }
+    return true;
+}
+
+bool oled_send_data_busy(void) {
+    if (oled_mock.busy_remaining) {
+        oled_mock.busy_remaining--;
+        return true;
+    }
+    if (oled_mock.pending_data) {
+        oled_mock_write_panel(oled_mock.pending_data, oled_mock.pending_size);
+        oled_mock.pending_data = NULL;
+    }
+    return false;
+}
+
+void oled_render_complete_user(void) {
+    oled_mock.completions++;
+}
+#endif
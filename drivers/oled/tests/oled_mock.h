@@ -0,0 +1,38 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_driver.h"
+
+#define OLED_MOCK_MAX_TRANSFERS 64
+
+typedef struct {
+    uint8_t  block;     // block addressed by the preceding bounds command
+    uint16_t size;      // bytes of render data
+    uint32_t start_ms;  // simulated time the transfer started
+} oled_mock_transfer_t;
+
+typedef struct {
+    oled_mock_transfer_t transfers[OLED_MOCK_MAX_TRANSFERS];
+    uint8_t              transfer_count;
+    uint16_t             busy_polls;       // polls a transfer stays busy for
+    uint16_t             busy_remaining;   // polls left on the current transfer
+    uint32_t             blocking_bytes;   // bytes sent while the caller waited
+    uint32_t             background_bytes; // bytes handed off to the background
+    uint32_t             data_bytes;       // render data sent either way
+    uint8_t              completions;      // oled_render_complete_user() calls
+    uint8_t              last_block;
+    uint8_t              panel[OLED_MATRIX_SIZE]; // what the controller's memory holds
+    uint8_t              column, column_start, column_end;
+    uint8_t              page, page_start, page_end;
+    bool                 horizontal_mode; // wrap within the column and page bounds, otherwise page addressing
+    const uint8_t       *pending_data;    // async transfer still to land on the panel
+    uint16_t             pending_size;
+} oled_mock_t;
+
+extern oled_mock_t oled_mock;
+
+void oled_mock_reset(uint16_t busy_polls);
@@ -0,0 +1,79 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "oled_rotate.h"
+}
+
+// The bit by bit rotation previously used by the OLED driver
+static uint8_t crot(uint8_t a, int8_t n) {
+    const uint8_t mask = 0x7;
+    n &= mask;
+    return a << n | a >> (-n & mask);
+}
+
+static void reference_rotate_90(const uint8_t *src, uint8_t *dest) {
+    for (uint8_t i = 0, shift = 7; i < 8; ++i, --shift) {
+        uint8_t selector = (1 << i);
+        for (uint8_t j = 0; j < 8; ++j) {
+            dest[i] |= crot(src[j] & selector, shift - (int8_t)j);
+        }
+    }
+}
+
+static void expect_same_rotation(const uint8_t *src) {
+    uint8_t expected[8] = {0};
+    uint8_t actual[8]   = {0};
+    reference_rotate_90(src, expected);
+    oled_rotate_90(src, actual);
+    for (uint8_t i = 0; i < 8; i++) {
+        EXPECT_EQ(expected[i], actual[i]) << "byte " << +i;
+    }
+}
+
+class OledRotate : public ::testing::Test {};
+
+TEST_F(OledRotate, SingleBits) {
+    for (uint8_t row = 0; row < 8; row++) {
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            uint8_t src[8] = {0};
+            src[row]       = 1 << bit;
+            expect_same_rotation(src);
+        }
+    }
+}
+
+TEST_F(OledRotate, Patterns) {
+    const uint8_t patterns[][8] = {
+        {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+        {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80},
+        {0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55},
+        {0x0F, 0x0F, 0x0F, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0},
+        {0x3E, 0x51, 0x49, 0x45, 0x3E, 0x00, 0x00, 0x00},
+    };
+    for (auto &pattern : patterns) {
+        expect_same_rotation(pattern);
+    }
+}
+
+TEST_F(OledRotate, PseudoRandomTiles) {
+    uint32_t state = 0x12345678;
+    for (uint16_t n = 0; n < 10000; n++) {
+        uint8_t src[8];
+        for (uint8_t i = 0; i < 8; i++) {
+            state  = state * 1664525 + 1013904223;
+            src[i] = state >> 24;
+        }
+        expect_same_rotation(src);
+    }
+}
+
+TEST_F(OledRotate, OrsIntoDestination) {
+    uint8_t src[8]  = {0};
+    uint8_t dest[8] = {0xFF, 0, 0, 0, 0, 0, 0, 0x80};
+    oled_rotate_90(src, dest);
+    EXPECT_EQ(dest[0], 0xFF);
+    EXPECT_EQ(dest[7], 0x80);
+}
@@ -0,0 +1,142 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdlib.h>
+#include <string.h>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "oled_driver.h"
+#include "oled_mock.h"
+}
+
+class OledShadow : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        srand(1);
+        oled_mock_reset(0);
+        oled_init(OLED_ROTATION_0);
+        render_all();
+    }
+
+    void render_all(void) {
+        for (uint8_t i = 0; i < OLED_BLOCK_COUNT; i++) {
+            oled_render();
+        }
+    }
+
+    const uint8_t *buffer(void) {
+        return oled_read_raw(0).current_element;
+    }
+
+    void expect_panel(void) {
+        ASSERT_EQ(memcmp(oled_mock.panel, buffer(), OLED_MATRIX_SIZE), 0);
+    }
+
+    // Bytes between the first and last difference of each block, and the number of blocks that differ
+    uint32_t changed_span_bytes(uint8_t *blocks) {
+        uint32_t bytes = 0;
+        *blocks        = 0;
+        for (uint16_t block = 0; block < OLED_BLOCK_COUNT; block++) {
+            int16_t first = -1, last = -1;
+            for (uint16_t i = 0; i < OLED_BLOCK_SIZE; i++) {
+                uint16_t index = block * OLED_BLOCK_SIZE + i;
+                if (oled_mock.panel[index] != buffer()[index]) {
+                    first = first < 0 ? i : first;
+                    last  = i;
+                }
+            }
+            if (first >= 0) {
+                bytes += last - first + 1;
+                (*blocks)++;
+            }
+        }
+        return bytes;
+    }
+};
+
+TEST_F(OledShadow, RandomWritesOnlySendChangedSpans) {
+    uint32_t sent = 0, unshadowed = 0;
+    for (uint16_t frame = 0; frame < 200; frame++) {
+        OLED_BLOCK_TYPE touched = 0;
+        uint8_t         writes  = rand() % 16;
+        for (uint8_t i = 0; i < writes; i++) {
+            uint16_t index = rand() % OLED_MATRIX_SIZE;
+            uint8_t  value = rand() % 4 ? rand() : buffer()[index] ^ 1;
+            if (rand() % 4 == 0) {
+                // change a byte and put it back, leaving the block dirty but unchanged
+                oled_write_raw_byte(value ^ 0x80, index);
+                value = buffer()[index] ^ 0x80;
+            }
+            oled_write_raw_byte(value, index);
+            touched |= (OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE);
+        }
+
+        uint8_t  blocks;
+        uint32_t expected = changed_span_bytes(&blocks);
+        oled_mock.data_bytes     = 0;
+        oled_mock.transfer_count = 0;
+        render_all();
+
+        expect_panel();
+        EXPECT_EQ(oled_mock.data_bytes, expected) << "frame " << frame;
+        EXPECT_EQ(oled_mock.transfer_count, blocks) << "frame " << frame;
+        sent += oled_mock.data_bytes;
+        unshadowed += __builtin_popcountll(touched) * OLED_BLOCK_SIZE;
+    }
+    printf("sent %u bytes, %u without the shadow buffer\n", (unsigned)sent, (unsigned)unshadowed);
+    EXPECT_LT(sent, unshadowed / 2);
+}
+
+TEST_F(OledShadow, SpanCoversFirstToLastChange) {
+    const uint16_t base = OLED_BLOCK_SIZE * 3;
+    oled_write_raw_byte(0x0F, base + 5);
+    oled_write_raw_byte(0xF0, base + 12);
+
+    oled_mock.transfer_count = 0;
+    render_all();
+
+    ASSERT_EQ(oled_mock.transfer_count, 1);
+    EXPECT_EQ(oled_mock.transfers[0].block, 3);
+    EXPECT_EQ(oled_mock.transfers[0].size, 8);
+    expect_panel();
+}
+
+TEST_F(OledShadow, UnchangedBlockIsSkippedWithoutCounting) {
+    // Block 0 is dirty but ends up as it was, block 1 really changed
+    oled_write_raw_byte(0x01, 0);
+    oled_write_raw_byte(0x00, 0);
+    oled_write_raw_byte(0x01, OLED_BLOCK_SIZE);
+
+    // With a limit of one block per call, the skipped block must not use it up
+    oled_mock.transfer_count = 0;
+    oled_render();
+
+    ASSERT_EQ(oled_mock.transfer_count, 1);
+    EXPECT_EQ(oled_mock.transfers[0].block, 1);
+    EXPECT_EQ(oled_mock.transfers[0].size, 1);
+    expect_panel();
+}
+
+TEST_F(OledShadow, StoppingScrollResendsEverything) {
+    ASSERT_TRUE(oled_scroll_left());
+    ASSERT_TRUE(oled_scroll_off());
+
+    oled_mock.transfer_count = 0;
+    oled_mock.data_bytes     = 0;
+    render_all();
+
+    EXPECT_EQ(oled_mock.transfer_count, OLED_BLOCK_COUNT);
+    EXPECT_EQ(oled_mock.data_bytes, OLED_MATRIX_SIZE);
+}
+
+TEST_F(OledShadow, InitResendsEverything) {
+    oled_init(OLED_ROTATION_0);
+
+    oled_mock.transfer_count = 0;
+    oled_mock.data_bytes     = 0;
+    render_all();
+
+    EXPECT_EQ(oled_mock.transfer_count, OLED_BLOCK_COUNT);
+    EXPECT_EQ(oled_mock.data_bytes, OLED_MATRIX_SIZE);
+}
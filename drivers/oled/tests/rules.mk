@@ -0,0 +1,48 @@
+oled_rotate_SRC := \
+	$(DRIVER_PATH)/oled/tests/oled_rotate_tests.cpp
+
+oled_rotate_INC := \
+	$(DRIVER_PATH)/oled
+
+oled_async_DEFS := -DOLED_ENABLE -DOLED_TRANSPORT_I2C -DOLED_ASYNC_FLUSH -DOLED_TIMEOUT=0 -DNO_PRINT
+
+oled_async_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(DRIVER_PATH)/oled/tests/oled_mock.c \
+	$(DRIVER_PATH)/oled/tests/oled_async_tests.cpp \
+	$(DRIVER_PATH)/oled/oled_driver.c
+
+oled_async_INC := \
+	$(DRIVER_PATH)/oled/tests \
+	$(DRIVER_PATH)/oled
+
+oled_blit_DEFS := -DOLED_ENABLE -DOLED_TRANSPORT_I2C -DOLED_TIMEOUT=0 -DNO_PRINT
+
+oled_blit_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(DRIVER_PATH)/oled/tests/oled_mock.c \
+	$(DRIVER_PATH)/oled/tests/oled_blit_tests.cpp \
+	$(DRIVER_PATH)/oled/oled_driver.c
+
+oled_blit_INC := \
+	$(DRIVER_PATH)/oled/tests \
+	$(DRIVER_PATH)/oled
+
+oled_shadow_DEFS := -DOLED_ENABLE -DOLED_TRANSPORT_I2C -DOLED_SHADOW_BUFFER -DOLED_TIMEOUT=0 -DNO_PRINT
+
+oled_shadow_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(DRIVER_PATH)/oled/tests/oled_mock.c \
+	$(DRIVER_PATH)/oled/tests/oled_shadow_tests.cpp \
+	$(DRIVER_PATH)/oled/oled_driver.c
+
+oled_shadow_INC := \
+	$(DRIVER_PATH)/oled/tests \
+	$(DRIVER_PATH)/oled
+
+# Page addressing mode, with a column offset to exercise the split column address
+oled_shadow_sh1106_DEFS := -DOLED_ENABLE -DOLED_TRANSPORT_I2C -DOLED_SHADOW_BUFFER -DOLED_IC=OLED_IC_SH1106 -DOLED_COLUMN_OFFSET=2 -DOLED_TIMEOUT=0 -DNO_PRINT
+
+oled_shadow_sh1106_SRC := $(oled_shadow_SRC)
+
+oled_shadow_sh1106_INC := $(oled_shadow_INC)
@@ -0,0 +1 @@
+TEST_LIST += oled_rotate oled_async oled_blit oled_shadow oled_shadow_sh1106
@@ -0,0 +1,394 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "color.h"
+#include "qp_palette_surface.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Common
+
+// Device definition
+typedef struct palette_surface_painter_device_t {
+    painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
+
+    // The target buffer, packed palette indices with the first pixel in the least significant bits of each byte
+    uint8_t *buffer;
+
+    // The colors each palette index represents
+    const HSV *palette;
+
+    // Manually manage the viewport for streaming pixel data to the display
+    uint16_t viewport_l;
+    uint16_t viewport_t;
+    uint16_t viewport_r;
+    uint16_t viewport_b;
+
+    // Current write location to the display when streaming pixel data
+    uint16_t pixdata_x;
+    uint16_t pixdata_y;
+
+    // Maintain a dirty region so we can stream only what we need
+    surface_dirty_data_t dirty;
+
+} palette_surface_painter_device_t;
+
+// Driver storage
+palette_surface_painter_device_t palette_surface_drivers[PALETTE_SURFACE_NUM_DEVICES] = {0};
+
+// Colors used when copying a mono surface to another device
+static const HSV mono_palette[2] = {
+    {.h = 0, .s = 0, .v = 0},
+    {.h = 0, .s = 0, .v = 255},
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+
+static inline uint8_t get_index(const uint8_t *buffer, uint32_t pixel, uint8_t bits_per_pixel) {
+    uint32_t bit = pixel * bits_per_pixel;
+    return (buffer[bit / 8] >> (bit % 8)) & ((1 << bits_per_pixel) - 1);
+}
+
+static inline void set_index(uint8_t *buffer, uint32_t pixel, uint8_t bits_per_pixel, uint8_t index) {
+    uint32_t bit    = pixel * bits_per_pixel;
+    uint8_t  mask   = ((1 << bits_per_pixel) - 1) << (bit % 8);
+    buffer[bit / 8] = (buffer[bit / 8] & ~mask) | ((index << (bit % 8)) & mask);
+}
+
+static inline void increment_pixdata_location(palette_surface_painter_device_t *surface) {
+    // Increment the X-position
+    surface->pixdata_x++;
+
+    // If the x-coord has gone past the right-side edge, loop it back around and increment the y-coord
+    if (surface->pixdata_x > surface->viewport_r) {
+        surface->pixdata_x = surface->viewport_l;
+        surface->pixdata_y++;
+    }
+
+    // If the y-coord has gone past the bottom, loop it back to the top
+    if (surface->pixdata_y > surface->viewport_b) {
+        surface->pixdata_y = surface->viewport_t;
+    }
+}
+
+static inline void setpixel(palette_surface_painter_device_t *surface, uint16_t x, uint16_t y, uint8_t index) {
+    uint32_t pixel = (uint32_t)y * surface->base.panel_width + x;
+
+    // Skip messing with the dirty info if the original value already matches
+    if (get_index(surface->buffer, pixel, surface->base.native_bits_per_pixel) != index) {
+        // Maintain dirty region
+        qp_surface_dirty_mark(&surface->dirty, x, y);
+
+        // Update the pixel data in the buffer
+        set_index(surface->buffer, pixel, surface->base.native_bits_per_pixel, index);
+    }
+}
+
+static inline void stream_pixdata(palette_surface_painter_device_t *surface, const uint8_t *data, uint32_t native_pixel_count) {
+    for (uint32_t pixel_counter = 0; pixel_counter < native_pixel_count; ++pixel_counter) {
+        setpixel(surface, surface->pixdata_x, surface->pixdata_y, get_index(data, pixel_counter, surface->base.native_bits_per_pixel));
+        increment_pixdata_location(surface);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Driver vtable
+
+static bool qp_palette_surface_init(painter_device_t device, painter_rotation_t rotation) {
+    painter_driver_t *                driver  = (painter_driver_t *)device;
+    palette_surface_painter_device_t *surface = (palette_surface_painter_device_t *)driver;
+    memset(surface->buffer, 0, PALETTE_SURFACE_BUFFER_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
+    return true;
+}
+
+static bool qp_palette_surface_power(painter_device_t device, bool power_on) {
+    // No-op.
+    return true;
+}
+
+static bool qp_palette_surface_clear(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    driver->driver_vtable->init(device, driver->rotation); // Re-init the surface
+    return true;
+}
+
+static bool qp_palette_surface_flush(painter_device_t device) {
+    painter_driver_t *                driver  = (painter_driver_t *)device;
+    palette_surface_painter_device_t *surface = (palette_surface_painter_device_t *)driver;
+    qp_surface_dirty_reset(&surface->dirty);
+    return true;
+}
+
+static bool qp_palette_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    painter_driver_t *                driver  = (painter_driver_t *)device;
+    palette_surface_painter_device_t *surface = (palette_surface_painter_device_t *)driver;
+
+    // Anything written through the previous viewport is kept as its own dirty rectangle
+    qp_surface_dirty_commit(&surface->dirty);
+
+    // Set the viewport locations
+    surface->viewport_l = left;
+    surface->viewport_t = top;
+    surface->viewport_r = right;
+    surface->viewport_b = bottom;
+
+    // Reset the write location to the top left
+    surface->pixdata_x = left;
+    surface->pixdata_y = top;
+    return true;
+}
+
+// Stream pixel data to the current write position in GRAM
+static bool qp_palette_surface_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    painter_driver_t *                driver  = (painter_driver_t *)device;
+    palette_surface_painter_device_t *surface = (palette_surface_painter_device_t *)driver;
+    stream_pixdata(surface, (const uint8_t *)pixel_data, native_pixel_count);
+    return true;
+}
+
+// Pixel colour conversion
+static bool qp_palette_surface_palette_convert_mono(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    for (int16_t i = 0; i < palette_size; ++i) {
+        palette[i].mono = (palette[i].hsv888.v >= 128) ? 1 : 0;
+    }
+    return true;
+}
+
+static bool qp_palette_surface_palette_convert_nearest(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    painter_driver_t *                driver  = (painter_driver_t *)device;
+    palette_surface_painter_device_t *surface = (palette_surface_painter_device_t *)driver;
+    const uint16_t                    entries = 1u << driver->native_bits_per_pixel;
+
+    for (int16_t i = 0; i < palette_size; ++i) {
+        // Colors taken from the surface's own palette are the common case, so look for an exact match first
+        uint16_t best_index = entries;
+        for (uint16_t j = 0; j < entries; ++j) {
+            if (surface->palette[j].h == palette[i].hsv888.h && surface->palette[j].s == palette[i].hsv888.s && surface->palette[j].v == palette[i].hsv888.v) {
+                best_index = j;
+                break;
+            }
+        }
+
+        // Otherwise pick the closest color by RGB distance
+        if (best_index == entries) {
+            RGB      rgb           = hsv_to_rgb_nocie((HSV){palette[i].hsv888.h, palette[i].hsv888.s, palette[i].hsv888.v});
+            uint32_t best_distance = UINT32_MAX;
+            for (uint16_t j = 0; j < entries; ++j) {
+                RGB      candidate = hsv_to_rgb_nocie(surface->palette[j]);
+                int16_t  dr        = (int16_t)rgb.r - candidate.r;
+                int16_t  dg        = (int16_t)rgb.g - candidate.g;
+                int16_t  db        = (int16_t)rgb.b - candidate.b;
+                uint32_t distance  = (uint32_t)(dr * dr) + (uint32_t)(dg * dg) + (uint32_t)(db * db);
+                if (distance < best_distance) {
+                    best_index    = j;
+                    best_distance = distance;
+                }
+            }
+        }
+
+        palette[i].palette_idx = (uint8_t)best_index;
+    }
+    return true;
+}
+
+// Append pixels to the target location, keyed by the pixel index
+static bool qp_palette_surface_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (driver->native_bits_per_pixel == 8) {
+        for (uint32_t i = 0; i < pixel_count; ++i) {
+            target_buffer[pixel_offset + i] = palette[palette_indices[i]].palette_idx;
+        }
+    } else {
+        for (uint32_t i = 0; i < pixel_count; ++i) {
+            set_index(target_buffer, pixel_offset + i, driver->native_bits_per_pixel, palette[palette_indices[i]].palette_idx);
+        }
+    }
+    return true;
+}
+
+// Append data to the target location
+static bool qp_palette_surface_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    target_buffer[pixdata_offset] = pixdata_byte;
+    return true;
+}
+
+const painter_driver_vtable_t mono1bpp_surface_driver_vtable = {
+    .init            = qp_palette_surface_init,
+    .power           = qp_palette_surface_power,
+    .clear           = qp_palette_surface_clear,
+    .flush           = qp_palette_surface_flush,
+    .pixdata         = qp_palette_surface_pixdata,
+    .viewport        = qp_palette_surface_viewport,
+    .palette_convert = qp_palette_surface_palette_convert_mono,
+    .append_pixels   = qp_palette_surface_append_pixels,
+    .append_pixdata  = qp_palette_surface_append_pixdata,
+};
+
+const painter_driver_vtable_t palette_surface_driver_vtable = {
+    .init            = qp_palette_surface_init,
+    .power           = qp_palette_surface_power,
+    .clear           = qp_palette_surface_clear,
+    .flush           = qp_palette_surface_flush,
+    .pixdata         = qp_palette_surface_pixdata,
+    .viewport        = qp_palette_surface_viewport,
+    .palette_convert = qp_palette_surface_palette_convert_nearest,
+    .append_pixels   = qp_palette_surface_append_pixels,
+    .append_pixdata  = qp_palette_surface_append_pixdata,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Comms vtable
+
+static bool qp_palette_surface_comms_init(painter_device_t device) {
+    // No-op.
+    return true;
+}
+static bool qp_palette_surface_comms_start(painter_device_t device) {
+    // No-op.
+    return true;
+}
+static void qp_palette_surface_comms_stop(painter_device_t device) {
+    // No-op.
+}
+uint32_t qp_palette_surface_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    // No-op.
+    return byte_count;
+}
+
+painter_comms_vtable_t palette_surface_driver_comms_vtable = {
+    // These are all effective no-op's because they're not actually needed.
+    .comms_init  = qp_palette_surface_comms_init,
+    .comms_start = qp_palette_surface_comms_start,
+    .comms_stop  = qp_palette_surface_comms_stop,
+    .comms_send  = qp_palette_surface_comms_send};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Factory functions for creating a handle to a mono/palette surface
+
+static painter_device_t make_surface(const painter_driver_vtable_t *vtable, uint16_t panel_width, uint16_t panel_height, uint8_t bits_per_pixel, const HSV *palette, void *buffer) {
+    for (uint32_t i = 0; i < PALETTE_SURFACE_NUM_DEVICES; ++i) {
+        palette_surface_painter_device_t *driver = &palette_surface_drivers[i];
+        if (!driver->base.driver_vtable) {
+            driver->base.driver_vtable         = vtable;
+            driver->base.comms_vtable          = &palette_surface_driver_comms_vtable;
+            driver->base.native_bits_per_pixel = bits_per_pixel;
+            driver->base.panel_width           = panel_width;
+            driver->base.panel_height          = panel_height;
+            driver->base.rotation              = QP_ROTATION_0;
+            driver->base.offset_x              = 0;
+            driver->base.offset_y              = 0;
+            driver->buffer                     = (uint8_t *)buffer;
+            driver->palette                    = palette;
+            qp_palette_surface_flush((painter_device_t)driver); // Start off with nothing dirty
+            return (painter_device_t)driver;
+        }
+    }
+    return NULL;
+}
+
+painter_device_t qp_mono1bpp_make_surface(uint16_t panel_width, uint16_t panel_height, void *buffer) {
+    return make_surface(&mono1bpp_surface_driver_vtable, panel_width, panel_height, 1, mono_palette, buffer);
+}
+
+painter_device_t qp_palette_make_surface(uint16_t panel_width, uint16_t panel_height, uint8_t bits_per_pixel, const HSV *palette, void *buffer) {
+    switch (bits_per_pixel) {
+        case 1:
+        case 2:
+        case 4:
+            break;
+#if QUANTUM_PAINTER_SUPPORTS_256_PALETTE
+        // Copying out goes through the global palette lookup table, so it needs to be large enough to hold every entry
+        case 8:
+            break;
+#endif
+        default:
+            qp_dprintf("qp_palette_make_surface: fail (unsupported bpp %d)\n", (int)bits_per_pixel);
+            return NULL;
+    }
+    return make_surface(&palette_surface_driver_vtable, panel_width, panel_height, bits_per_pixel, palette, buffer);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Drawing routine to copy out the dirty region and send it to another device
+
+static bool qp_palette_surface_draw_rect(palette_surface_painter_device_t *surface_handle, painter_device_t display, uint16_t x, uint16_t y, const surface_dirty_rect_t *rect) {
+    painter_driver_t *display_driver = (painter_driver_t *)display;
+
+    // Set the target drawing area
+    if (!display_driver->driver_vtable->viewport(display, x + rect->l, y + rect->t, x + rect->r, y + rect->b)) {
+        return false;
+    }
+
+    // Unpack each row in spans, converting to the display's native pixel format through the already-converted palette
+    qp_internal_pixel_output_state_t output_state = {.device = display, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(display)};
+    uint8_t                          indices[QUANTUM_PAINTER_DECODE_SPAN_SIZE];
+    for (uint16_t y = rect->t; y <= rect->b; ++y) {
+        uint32_t pixel     = (uint32_t)y * surface_handle->base.panel_width + rect->l;
+        uint32_t remaining = rect->r - rect->l + 1;
+        while (remaining > 0) {
+            uint16_t span_pixels = QP_MIN(remaining, QUANTUM_PAINTER_DECODE_SPAN_SIZE);
+            for (uint16_t i = 0; i < span_pixels; ++i) {
+                indices[i] = get_index(surface_handle->buffer, pixel++, surface_handle->base.native_bits_per_pixel);
+            }
+            if (!qp_internal_pixel_span_appender(qp_internal_global_pixel_lookup_table, indices, span_pixels, &output_state)) {
+                return false;
+            }
+            remaining -= span_pixels;
+        }
+    }
+
+    // If there's any leftover data, send it
+    if (output_state.pixel_write_pos > 0) {
+        return qp_internal_send_pixdata_buffer(display, output_state.pixel_write_pos);
+    }
+
+    return true;
+}
+
+bool qp_palette_surface_draw(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y) {
+    painter_driver_t *                surface_driver = (painter_driver_t *)surface;
+    palette_surface_painter_device_t *surface_handle = (palette_surface_painter_device_t *)surface_driver;
+    painter_driver_t *                display_driver = (painter_driver_t *)display;
+
+    // If we're not dirty... we're done.
+    if (!surface_handle->dirty.is_dirty) {
+        return true;
+    }
+
+    if (!display_driver || !display_driver->validate_ok) {
+        qp_dprintf("qp_palette_surface_draw: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    if (!qp_comms_start(display)) {
+        qp_dprintf("qp_palette_surface_draw: fail (could not start comms)\n");
+        return false;
+    }
+
+    // Convert the surface's palette to the display's native pixel format -- this overwrites the global lookup table, so
+    // make sure nothing else assumes it's still intact
+    const uint16_t entries = 1u << surface_driver->native_bits_per_pixel;
+    for (uint16_t i = 0; i < entries; ++i) {
+        qp_internal_global_pixel_lookup_table[i].hsv888.h = surface_handle->palette[i].h;
+        qp_internal_global_pixel_lookup_table[i].hsv888.s = surface_handle->palette[i].s;
+        qp_internal_global_pixel_lookup_table[i].hsv888.v = surface_handle->palette[i].v;
+    }
+    qp_internal_invalidate_palette();
+    bool ok = display_driver->driver_vtable->palette_convert(display, entries, qp_internal_global_pixel_lookup_table);
+
+    // Send each dirty rectangle separately, so that distant updates don't drag the untouched area between them along
+    qp_surface_dirty_commit(&surface_handle->dirty);
+    for (uint8_t i = 0; ok && i < surface_handle->dirty.rect_count; ++i) {
+        ok = qp_palette_surface_draw_rect(surface_handle, display, x, y, &surface_handle->dirty.rects[i]);
+    }
+
+    qp_dprintf("qp_palette_surface_draw: %s\n", ok ? "ok" : "fail");
+    qp_comms_stop(display);
+    if (!ok) {
+        return false;
+    }
+
+    // Clear the dirty info for the surface
+    return qp_flush(surface);
+}
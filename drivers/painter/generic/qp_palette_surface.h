@@ -0,0 +1,71 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include "color.h"
+#include "qp_internal.h"
+#include "qp_surface_dirty.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter palette surface configurables (add to your keyboard's config.h)
+
+#ifndef PALETTE_SURFACE_NUM_DEVICES
+/**
+ * @def This controls the maximum number of mono/palette surface devices that Quantum Painter can use at any one time.
+ *      Increasing this number allows for multiple framebuffers to be used. Each requires its own RAM allocation.
+ */
+#    define PALETTE_SURFACE_NUM_DEVICES 1
+#endif
+
+/**
+ * Number of bytes required for the buffer of a mono/palette surface.
+ */
+#define PALETTE_SURFACE_BUFFER_SIZE(panel_width, panel_height, bits_per_pixel) ((((uint32_t)(panel_width) * (panel_height) * (bits_per_pixel)) + 7) / 8)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Forward declarations
+
+#ifdef QUANTUM_PAINTER_PALETTE_SURFACE_ENABLE
+/**
+ * Factory method for a monochrome surface (aka framebuffer), using 1 bit per pixel.
+ *
+ * Colors with a value of at least 50% are drawn as "on" pixels, everything else is "off". When copied to another
+ * device, "on" pixels are drawn white and "off" pixels are drawn black.
+ *
+ * @param panel_width[in] the width of the display panel
+ * @param panel_height[in] the height of the display panel
+ * @param buffer[in] pointer to a preallocated buffer of size `PALETTE_SURFACE_BUFFER_SIZE(panel_width, panel_height, 1)`
+ * @return the device handle used with all drawing routines in Quantum Painter
+ */
+painter_device_t qp_mono1bpp_make_surface(uint16_t panel_width, uint16_t panel_height, void *buffer);
+
+/**
+ * Factory method for a palette surface (aka framebuffer), storing a palette index for each pixel.
+ *
+ * Colors are drawn as the closest matching entry in the palette. 8bpp surfaces require
+ * `QUANTUM_PAINTER_SUPPORTS_256_PALETTE`.
+ *
+ * @param panel_width[in] the width of the display panel
+ * @param panel_height[in] the height of the display panel
+ * @param bits_per_pixel[in] the number of bits used for each palette index -- 1, 2, 4, or 8
+ * @param palette[in] pointer to `(1 << bits_per_pixel)` palette entries, which must remain valid for the lifetime of the surface
+ * @param buffer[in] pointer to a preallocated buffer of size `PALETTE_SURFACE_BUFFER_SIZE(panel_width, panel_height, bits_per_pixel)`
+ * @return the device handle used with all drawing routines in Quantum Painter
+ */
+painter_device_t qp_palette_make_surface(uint16_t panel_width, uint16_t panel_height, uint8_t bits_per_pixel, const HSV *palette, void *buffer);
+
+/**
+ * Helper method to draw the dirty contents of a mono/palette framebuffer to the target device.
+ *
+ * Pixels are converted to the target device's native format as they're sent, so any display can be used as the target.
+ * Each dirty rectangle is sent as its own viewport and pixel data transfer. After successful completion, the dirty area
+ * is reset.
+ *
+ * @param surface[in] the surface to copy from
+ * @param display[in] the display to copy into
+ * @param x[in] the x-location of the original position of the framebuffer
+ * @param y[in] the y-location of the original position of the framebuffer
+ * @return whether the draw operation completed successfully
+ */
+bool qp_palette_surface_draw(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y);
+#endif // QUANTUM_PAINTER_PALETTE_SURFACE_ENABLE
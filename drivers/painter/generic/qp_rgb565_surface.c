@@ -25,11 +25,7 @@ typedef struct rgb565_surface_painter_device_t {
     uint16_t pixdata_y;
 
     // Maintain a dirty region so we can stream only what we need
-    bool     is_dirty;
-    uint16_t dirty_l;
-    uint16_t dirty_t;
-    uint16_t dirty_r;
-    uint16_t dirty_b;
+    surface_dirty_data_t dirty;
 
 } rgb565_surface_painter_device_t;
 
@@ -59,21 +55,7 @@ static inline void setpixel(rgb565_surface_painter_device_t *surface, uint16_t x
     // Skip messing with the dirty info if the original value already matches
     if (surface->buffer[y * surface->base.panel_width + x] != rgb565) {
         // Maintain dirty region
-        if (surface->dirty_l > x) {
-            surface->dirty_l = x;
-        }
-        if (surface->dirty_r < x) {
-            surface->dirty_r = x;
-        }
-        if (surface->dirty_t > y) {
-            surface->dirty_t = y;
-        }
-        if (surface->dirty_b < y) {
-            surface->dirty_b = y;
-        }
-
-        // Always dirty after a setpixel
-        surface->is_dirty = true;
+        qp_surface_dirty_mark(&surface->dirty, x, y);
 
         // Update the pixel data in the buffer
         surface->buffer[y * surface->base.panel_width + x] = rgb565;
@@ -115,9 +97,7 @@ static bool qp_rgb565_surface_clear(painter_device_t device) {
 static bool qp_rgb565_surface_flush(painter_device_t device) {
     painter_driver_t *               driver  = (painter_driver_t *)device;
     rgb565_surface_painter_device_t *surface = (rgb565_surface_painter_device_t *)driver;
-    surface->dirty_l = surface->dirty_t = UINT16_MAX;
-    surface->dirty_r = surface->dirty_b = 0;
-    surface->is_dirty                   = false;
+    qp_surface_dirty_reset(&surface->dirty);
     return true;
 }
 
@@ -125,6 +105,9 @@ static bool qp_rgb565_surface_viewport(painter_device_t device, uint16_t left, u
     painter_driver_t *               driver  = (painter_driver_t *)device;
     rgb565_surface_painter_device_t *surface = (rgb565_surface_painter_device_t *)driver;
 
+    // Anything written through the previous viewport is kept as its own dirty rectangle
+    qp_surface_dirty_commit(&surface->dirty);
+
     // Set the viewport locations
     surface->viewport_l = left;
     surface->viewport_t = top;
@@ -224,6 +207,7 @@ painter_device_t qp_rgb565_make_surface(uint16_t panel_width, uint16_t panel_hei
             driver->base.offset_x              = 0;
             driver->base.offset_y              = 0;
             driver->buffer                     = (uint16_t *)buffer;
+            qp_rgb565_surface_flush((painter_device_t)driver); // Start off with nothing dirty
             return (painter_device_t)driver;
         }
     }
@@ -233,17 +217,9 @@ painter_device_t qp_rgb565_make_surface(uint16_t panel_width, uint16_t panel_hei
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Drawing routine to copy out the dirty region and send it to another device
 
-bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y) {
-    painter_driver_t *               surface_driver = (painter_driver_t *)surface;
-    rgb565_surface_painter_device_t *surface_handle = (rgb565_surface_painter_device_t *)surface_driver;
-
-    // If we're not dirty... we're done.
-    if (!surface_handle->is_dirty) {
-        return true;
-    }
-
+static bool qp_rgb565_surface_draw_rect(rgb565_surface_painter_device_t *surface_handle, painter_device_t display, uint16_t x, uint16_t y, const surface_dirty_rect_t *rect) {
     // Set the target drawing area
-    bool ok = qp_viewport(display, x + surface_handle->dirty_l, y + surface_handle->dirty_t, x + surface_handle->dirty_r, y + surface_handle->dirty_b);
+    bool ok = qp_viewport(display, x + rect->l, y + rect->t, x + rect->r, y + rect->b);
     if (!ok) {
         return false;
     }
@@ -254,8 +230,8 @@ bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display,
     uint16_t *target_buffer     = (uint16_t *)qp_internal_global_pixdata_buffer;
 
     // Fill the global pixdata area so that we can start transferring to the panel
-    for (uint16_t y = surface_handle->dirty_t; y <= surface_handle->dirty_b; ++y) {
-        for (uint16_t x = surface_handle->dirty_l; x <= surface_handle->dirty_r; ++x) {
+    for (uint16_t y = rect->t; y <= rect->b; ++y) {
+        for (uint16_t x = rect->l; x <= rect->r; ++x) {
             // Update the target buffer
             target_buffer[pixel_counter++] = surface_handle->buffer[y * surface_handle->base.panel_width + x];
 
@@ -279,6 +255,26 @@ bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display,
         }
     }
 
+    return true;
+}
+
+bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y) {
+    painter_driver_t *               surface_driver = (painter_driver_t *)surface;
+    rgb565_surface_painter_device_t *surface_handle = (rgb565_surface_painter_device_t *)surface_driver;
+
+    // If we're not dirty... we're done.
+    if (!surface_handle->dirty.is_dirty) {
+        return true;
+    }
+
+    // Send each dirty rectangle separately, so that distant updates don't drag the untouched area between them along
+    qp_surface_dirty_commit(&surface_handle->dirty);
+    for (uint8_t i = 0; i < surface_handle->dirty.rect_count; ++i) {
+        if (!qp_rgb565_surface_draw_rect(surface_handle, display, x, y, &surface_handle->dirty.rects[i])) {
+            return false;
+        }
+    }
+
     // Clear the dirty info for the surface
     return qp_flush(surface);
 }
@@ -1,6 +1,7 @@
 // Copyright 2022 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 #include "qp_internal.h"
+#include "qp_surface_dirty.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter RGB565 surface configurables (add to your keyboard's config.h)
@@ -30,7 +31,8 @@ painter_device_t qp_rgb565_make_surface(uint16_t panel_width, uint16_t panel_hei
 /**
  * Helper method to draw the dirty contents of the framebuffer to the target device.
  *
- * After successful completion, the dirty area is reset.
+ * Each dirty rectangle is sent as its own viewport and pixel data transfer. After successful completion, the dirty area
+ * is reset.
  *
  * @param surface[in] the surface to copy from
  * @param display[in] the display to copy into
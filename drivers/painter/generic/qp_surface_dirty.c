@@ -0,0 +1,66 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "qp_surface_dirty.h"
+
+// Extra pixels a merge may pull in before it's cheaper to send a separate rectangle -- roughly the cost of the additional
+// viewport command on a typical SPI panel
+#define SURFACE_DIRTY_RECT_MERGE_SLACK 32
+
+static inline uint32_t dirty_rect_area(const surface_dirty_rect_t *rect) {
+    return (uint32_t)(rect->r - rect->l + 1) * (rect->b - rect->t + 1);
+}
+
+static inline surface_dirty_rect_t dirty_rect_union(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    return (surface_dirty_rect_t){
+        .l = QP_MIN(a->l, b->l),
+        .t = QP_MIN(a->t, b->t),
+        .r = QP_MAX(a->r, b->r),
+        .b = QP_MAX(a->b, b->b),
+    };
+}
+
+static void add_dirty_rect(surface_dirty_data_t *dirty, surface_dirty_rect_t rect) {
+    while (dirty->rect_count > 0) {
+        // Find the existing rectangle which wastes the fewest clean pixels when merged with this one
+        uint8_t  best_index = 0;
+        int32_t  best_waste = INT32_MAX;
+        uint32_t rect_area  = dirty_rect_area(&rect);
+        for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+            surface_dirty_rect_t merged = dirty_rect_union(&dirty->rects[i], &rect);
+            int32_t              waste  = (int32_t)dirty_rect_area(&merged) - (int32_t)dirty_rect_area(&dirty->rects[i]) - (int32_t)rect_area;
+            if (waste < best_waste) {
+                best_index = i;
+                best_waste = waste;
+            }
+        }
+
+        // Keep it separate if merging costs more than sending it on its own, as long as there's room for it
+        if (best_waste > SURFACE_DIRTY_RECT_MERGE_SLACK && dirty->rect_count < QUANTUM_PAINTER_SURFACE_DIRTY_RECTS) {
+            break;
+        }
+
+        // Merge, then go around again as the larger rectangle may now be worth merging with another
+        rect                     = dirty_rect_union(&dirty->rects[best_index], &rect);
+        dirty->rects[best_index] = dirty->rects[dirty->rect_count - 1];
+        dirty->rect_count--;
+    }
+
+    dirty->rects[dirty->rect_count++] = rect;
+}
+
+void qp_surface_dirty_reset(surface_dirty_data_t *dirty) {
+    dirty->l = dirty->t = UINT16_MAX;
+    dirty->r = dirty->b = 0;
+    dirty->rect_count   = 0;
+    dirty->is_dirty     = false;
+}
+
+void qp_surface_dirty_commit(surface_dirty_data_t *dirty) {
+    if (dirty->l > dirty->r) {
+        return;
+    }
+
+    add_dirty_rect(dirty, (surface_dirty_rect_t){.l = dirty->l, .t = dirty->t, .r = dirty->r, .b = dirty->b});
+    dirty->l = dirty->t = UINT16_MAX;
+    dirty->r = dirty->b = 0;
+}
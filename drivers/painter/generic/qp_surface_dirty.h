@@ -0,0 +1,67 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include "qp_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter surface configurables (add to your keyboard's config.h)
+
+#ifndef QUANTUM_PAINTER_SURFACE_DIRTY_RECTS
+/**
+ * @def This controls the maximum number of dirty rectangles tracked by each surface.
+ *      Separate updates are sent to the target display as separate rectangles, up to this limit. Setting this to 1
+ *      reverts to a single bounding box around everything that changed.
+ */
+#    define QUANTUM_PAINTER_SURFACE_DIRTY_RECTS 4
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Dirty region tracking shared by the surface drivers
+
+// Dirty rectangle, inclusive coordinates
+typedef struct surface_dirty_rect_t {
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+} surface_dirty_rect_t;
+
+typedef struct surface_dirty_data_t {
+    // Dirty region for the current viewport, maintained per-pixel
+    bool     is_dirty;
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+
+    // Dirty regions from previous viewports, merged as they're added
+    uint8_t              rect_count;
+    surface_dirty_rect_t rects[QUANTUM_PAINTER_SURFACE_DIRTY_RECTS];
+} surface_dirty_data_t;
+
+// Marks a single pixel as dirty
+static inline void qp_surface_dirty_mark(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
+    if (dirty->l > x) {
+        dirty->l = x;
+    }
+    if (dirty->r < x) {
+        dirty->r = x;
+    }
+    if (dirty->t > y) {
+        dirty->t = y;
+    }
+    if (dirty->b < y) {
+        dirty->b = y;
+    }
+
+    // Always dirty after a setpixel
+    dirty->is_dirty = true;
+}
+
+// Resets the dirty info, as if nothing has been drawn
+void qp_surface_dirty_reset(surface_dirty_data_t *dirty);
+
+// Moves the dirty region of the current viewport into the list of dirty rectangles -- call before changing viewport,
+// and before walking the list of dirty rectangles
+void qp_surface_dirty_commit(surface_dirty_data_t *dirty);
@@ -74,3 +74,19 @@
  *         - Wait 50us to reset the LEDs
  */
 void ws2812_setleds(LED_TYPE *ledarray, uint16_t number_of_leds);
+
+#if defined(WS2812_DRIVER_SPI) && defined(WS2812_SPI_DOUBLE_BUFFER)
+/* Double-buffered output (SPI driver only)
+ *
+ * Frames are rendered into the back buffer and committed with ws2812_swap(),
+ * ws2812_setleds() copies into it and commits. Committing copies the frame out,
+ * so the back buffer can be redrawn straight away. ws2812_task() then encodes
+ * the frame a chunk at a time and starts its transfer once the previous one
+ * has finished, so the scan loop never waits on the LEDs.
+ */
+LED_TYPE *ws2812_back_buffer(void);
+void      ws2812_swap(uint16_t number_of_leds);
+
+// Returns true while a committed frame is still waiting to be sent
+bool ws2812_task(void);
+#endif
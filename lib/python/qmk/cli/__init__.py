@@ -60,6 +60,7 @@ subcommands = [
     'qmk.cli.generate.keycodes_tests',
     'qmk.cli.generate.make_dependencies',
     'qmk.cli.generate.rgb_breathe_table',
+    'qmk.cli.generate.rgb_gamma_lut',
     'qmk.cli.generate.rules_mk',
     'qmk.cli.generate.version_h',
     'qmk.cli.git.submodule',
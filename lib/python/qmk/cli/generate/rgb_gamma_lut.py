@@ -0,0 +1,72 @@
+"""Generate rgb_matrix_gamma_lut.h
+"""
+from argparse import ArgumentTypeError
+
+from milc import cli
+
+from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE
+from qmk.commands import dump_lines
+from qmk.path import normpath
+
+
+def gamma_exponent(value):
+    value = float(value)
+    if value >= 0.25 and value <= 4:
+        return value
+    else:
+        raise ArgumentTypeError('Gamma must be between 0.25 and 4')
+
+
+def channel_max(value):
+    value = int(value)
+    if value in range(0, 256):
+        return value
+    else:
+        raise ArgumentTypeError('Channel maximum must be between 0 and 255')
+
+
+def _channel_values(gamma, maximum):
+    return [int(round(maximum * (pos / 255)**gamma)) for pos in range(0, 256)]
+
+
+def _generate_table(lines, gamma, maxima):
+    channels_template = ''
+    for name, maximum in zip(('red', 'green', 'blue'), maxima):
+        values = _channel_values(gamma, maximum)
+
+        channels_template += '    {{ // {}\n'.format(name)
+        for pos in range(0, 256, 16):
+            channels_template += '        ' + ', '.join('0x{:02X}'.format(v) for v in values[pos:pos + 16])
+            channels_template += ',\n' if pos + 16 < 256 else '\n'
+        channels_template += '    },\n' if name != 'blue' else '    }'
+
+    table_template = '''// Gamma:     {0:.2f}
+// Red max:   {1:d}
+// Green max: {2:d}
+// Blue max:  {3:d}
+
+const uint8_t rgb_matrix_gamma_lut[3][256] PROGMEM = {{
+{4}
+}};
+'''.format(gamma, *maxima, channels_template)
+    lines.append(table_template)
+
+
+@cli.argument('-g', '--gamma', arg_only=True, type=gamma_exponent, default=1.0, help='The exponent applied to every channel, from 0.25 to 4. Default: 1.0, as RGB Matrix colors are already lightness corrected')
+@cli.argument('--red', arg_only=True, type=channel_max, default=255, help='The output for full red, from 0 to 255. Default: 255')
+@cli.argument('--green', arg_only=True, type=channel_max, default=255, help='The output for full green, from 0 to 255. Default: 255')
+@cli.argument('--blue', arg_only=True, type=channel_max, default=255, help='The output for full blue, from 0 to 255. Default: 255')
+@cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
+@cli.argument('-q', '--quiet', arg_only=True, action='store_true', help='Quiet mode, only output error messages')
+@cli.subcommand('Generates an RGB Matrix per channel correction table header.')
+def generate_rgb_gamma_lut(cli):
+    """Generate a rgb_matrix_gamma_lut.h file containing the per channel LUT used by RGB_MATRIX_GAMMA_LUT.
+    """
+
+    # Build the header file.
+    header_lines = [GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, '#pragma once', '// clang-format off']
+
+    _generate_table(header_lines, cli.args.gamma, (cli.args.red, cli.args.green, cli.args.blue))
+
+    # Show the results
+    dump_lines(cli.args.output, header_lines, cli.args.quiet)
@@ -14,7 +14,9 @@ from PIL import Image
 @cli.argument('-o', '--output', default='', help='Specify output directory. Defaults to same directory as input.')
 @cli.argument('-f', '--format', required=True, help='Output format, valid types: %s' % (', '.join(valid_formats.keys())))
 @cli.argument('-r', '--no-rle', arg_only=True, action='store_true', help='Disables the use of RLE when encoding images.')
+@cli.argument('-z', '--no-lz', arg_only=True, action='store_true', help='Disables the use of LZ when encoding images.')
 @cli.argument('-d', '--no-deltas', arg_only=True, action='store_true', help='Disables the use of delta frames when encoding animations.')
+@cli.argument('-t', '--delta-tile-size', arg_only=True, type=int, default=8, help='Size of the tiles delta frames are split into, so only changed tiles are stored and drawn. 0 disables tiling. Defaults to 8.')
 @cli.argument('-w', '--raw', arg_only=True, action='store_true', help='Writes out the QGF file as raw data instead of c/h combo.')
 @cli.subcommand('Converts an input image to something QMK understands')
 def painter_convert_graphics(cli):
@@ -46,12 +48,18 @@ def painter_convert_graphics(cli):
     # Work out the encoding parameters
     format = valid_formats[cli.args.format]
 
+    # Tile sizes are stored in a byte
+    if not 0 <= cli.args.delta_tile_size <= 255:
+        cli.log.error('Delta tile size %d is invalid. Allowed values: 0-255' % (cli.args.delta_tile_size))
+        cli.print_usage()
+        return False
+
     # Load the input image
     input_img = Image.open(cli.args.input)
 
     # Convert the image to QGF using PIL
     out_data = BytesIO()
-    input_img.save(out_data, "QGF", use_deltas=(not cli.args.no_deltas), use_rle=(not cli.args.no_rle), qmk_format=format, verbose=cli.args.verbose)
+    input_img.save(out_data, "QGF", use_deltas=(not cli.args.no_deltas), delta_tile_size=cli.args.delta_tile_size, use_rle=(not cli.args.no_rle), use_lz=(not cli.args.no_lz), qmk_format=format, verbose=cli.args.verbose)
     out_bytes = out_data.getvalue()
 
     if cli.args.raw:
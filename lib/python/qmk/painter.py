@@ -239,6 +239,8 @@ def convert_image_bytes(im, format):
         # Export the palette
         palette = []
         pal = im.getpalette()
+        # Newer versions of PIL only return the used entries, so pad out to the full palette size
+        pal = pal + [0] * (ncolors * 3 - len(pal))
         for n in range(0, ncolors * 3, 3):
             palette.append((pal[n + 0], pal[n + 1], pal[n + 2]))
 
@@ -328,3 +330,64 @@ def compress_bytes_qmk_rle(bytearray):
                 temp = []
                 repeat = False
     return output
+
+
+def compress_bytes_qmk_lz(bytearray):
+    """Compresses bytes using QMK's LZ scheme, see docs/quantum_painter_lz.md.
+
+    Greedy longest match, searching the most recent positions starting with the same three bytes.
+    """
+    window_size = 256
+    min_match = 3
+    max_match = min_match + 255
+    max_candidates = 64
+
+    output = []
+    flags_pos = 0
+    items = 8
+    recent = {}
+
+    def remember(pos):
+        if pos + min_match <= len(bytearray):
+            recent.setdefault(tuple(bytearray[pos:pos + min_match]), []).append(pos)
+
+    pos = 0
+    while pos < len(bytearray):
+        # Each group of eight items starts with a byte of flags, LSb first, set bits denoting matches
+        if items == 8:
+            flags_pos = len(output)
+            output.append(0)
+            items = 0
+
+        # Find the longest match in the window, preferring the closest
+        best_length = 0
+        best_distance = 0
+        if pos + min_match <= len(bytearray):
+            candidates = recent.get(tuple(bytearray[pos:pos + min_match]), [])
+            for candidate in reversed(candidates[-max_candidates:]):
+                distance = pos - candidate
+                if distance > window_size:
+                    break
+                length = min_match
+                while length < max_match and pos + length < len(bytearray) and bytearray[candidate + length] == bytearray[pos + length]:
+                    length += 1
+                if length > best_length:
+                    best_length = length
+                    best_distance = distance
+                    if length == max_match:
+                        break
+
+        if best_length >= min_match:
+            output[flags_pos] |= 1 << items
+            output.append(best_distance - 1)
+            output.append(best_length - min_match)
+        else:
+            best_length = 1
+            output.append(bytearray[pos])
+
+        for n in range(pos, pos + best_length):
+            remember(n)
+        pos += best_length
+        items += 1
+
+    return output
@@ -131,6 +131,17 @@ class QGFFrameDescriptorV1:
         else:
             self.flags &= ~0x02
 
+    @property
+    def has_delta_tiles(self):
+        return (self.flags & 0x04) == 0x04
+
+    @has_delta_tiles.setter
+    def has_delta_tiles(self, val):
+        if val:
+            self.flags |= 0x04
+        else:
+            self.flags &= ~0x04
+
 
 ########################################################################################################################
 
@@ -184,6 +195,34 @@ class QGFFrameDeltaDescriptorV1:
 ########################################################################################################################
 
 
+class QGFFrameDeltaTilesDescriptorV1:
+    type_id = 0x06
+
+    def __init__(self):
+        self.header = QGFBlockHeader()
+        self.header.type_id = QGFFrameDeltaTilesDescriptorV1.type_id
+        self.tile_width = 0
+        self.tile_height = 0
+        self.present = []
+
+    @property
+    def length(self):
+        return 2 + (len(self.present) + 7) // 8
+
+    def write(self, fp):
+        self.header.length = self.length
+        self.header.write(fp)
+        fp.write(b''  # start off with empty bytes...
+                 + o8(self.tile_width)  # tile width
+                 + o8(self.tile_height)  # tile height
+                 )
+        for n in range(0, len(self.present), 8):
+            fp.write(o8(sum(1 << bit for bit, changed in enumerate(self.present[n:n + 8]) if changed)))
+
+
+########################################################################################################################
+
+
 class QGFFrameDataDescriptorV1:
     type_id = 0x05
 
@@ -230,12 +269,48 @@ def _save(im, fp, filename):
     verbose = encoderinfo.get("verbose", False)
     use_deltas = encoderinfo.get("use_deltas", True)
     use_rle = encoderinfo.get("use_rle", True)
+    use_lz = encoderinfo.get("use_lz", True)
+    delta_tile_size = encoderinfo.get("delta_tile_size", 8)
+    if not 0 <= delta_tile_size <= 255:
+        raise ValueError("Delta tile size must be between 0 and 255")
 
     # Helper for inline verbose prints
     def vprint(s):
         if verbose:
             print(s)
 
+    # Helper to pick the smallest of the enabled compression schemes for the supplied bytes, preferring no compression
+    def _compress(raw_data):
+        candidates = [(0x00, raw_data)]  # See qp.h, painter_compression_t
+        if use_rle:
+            candidates.append((0x01, qmk.painter.compress_bytes_qmk_rle(raw_data)))
+        if use_lz:
+            candidates.append((0x02, qmk.painter.compress_bytes_qmk_lz(raw_data)))
+        return min(candidates, key=lambda c: len(c[1]))
+
+    # Helper to split the changed area of a delta frame into tiles, returning which tiles changed and the rectangles
+    # covering each horizontal run of changed tiles, relative to the changed area
+    def _delta_tiles(diff, bbox):
+        width = bbox[2] - bbox[0]
+        height = bbox[3] - bbox[1]
+        present = []
+        runs = []
+        for top in range(0, height, delta_tile_size):
+            bottom = min(top + delta_tile_size, height)
+            run_left = None
+            for left in range(0, width + delta_tile_size, delta_tile_size):
+                changed = False
+                if left < width:
+                    tile = (bbox[0] + left, bbox[1] + top, bbox[0] + min(left + delta_tile_size, width), bbox[1] + bottom)
+                    changed = diff.crop(tile).getbbox() is not None
+                    present.append(changed)
+                if changed and run_left is None:
+                    run_left = left
+                elif not changed and run_left is not None:
+                    runs.append((run_left, top, min(left, width), bottom))
+                    run_left = None
+        return (present, runs)
+
     # Helper to iterate through all frames in the input image
     def _for_all_frames(x: FunctionType):
         frame_num = 0
@@ -290,15 +365,12 @@ def _save(im, fp, filename):
         converted = qmk.painter.convert_requested_format(this_frame, format)
         graphic_data = qmk.painter.convert_image_bytes(converted, format)
 
-        # Convert the raw data to RLE-encoded if requested
-        raw_data = graphic_data[1]
-        if use_rle:
-            rle_data = qmk.painter.compress_bytes_qmk_rle(graphic_data[1])
-        use_raw_this_frame = not use_rle or len(raw_data) <= len(rle_data)
-        image_data = raw_data if use_raw_this_frame else rle_data
+        # Compress the raw data if requested
+        (compression, image_data) = _compress(graphic_data[1])
 
         # Work out if a delta frame is smaller than injecting it directly
         use_delta_this_frame = False
+        delta_tiles = None
         if use_deltas and last_frame is not None:
             # If we want to use deltas, then find the difference
             diff = ImageChops.difference(frame, last_frame)
@@ -316,27 +388,37 @@ def _save(im, fp, filename):
                 # Convert the delta frame to the requested format
                 delta_converted = qmk.painter.convert_requested_format(delta_frame, format)
                 delta_graphic_data = qmk.painter.convert_image_bytes(delta_converted, format)
+                delta_extra_length = QGFFrameDeltaDescriptorV1.length
+
+                # If only some tiles of the delta frame changed, only keep those -- each horizontal run of tiles is
+                # stored as its own rectangle, sharing the delta frame's palette
+                if delta_tile_size > 0:
+                    (present, runs) = _delta_tiles(diff, bbox)
+                    if not all(present):
+                        delta_tiles = QGFFrameDeltaTilesDescriptorV1()
+                        delta_tiles.tile_width = delta_tile_size
+                        delta_tiles.tile_height = delta_tile_size
+                        delta_tiles.present = present
+                        tile_bytes = []
+                        for run in runs:
+                            tile_bytes.extend(qmk.painter.convert_image_bytes(delta_converted.crop(run), format)[1])
+                        delta_graphic_data = (delta_graphic_data[0], tile_bytes)
+                        delta_extra_length += delta_tiles.length
 
                 # Work out how large the delta frame is going to be with compression etc.
-                delta_raw_data = delta_graphic_data[1]
-                if use_rle:
-                    delta_rle_data = qmk.painter.compress_bytes_qmk_rle(delta_graphic_data[1])
-                delta_use_raw_this_frame = not use_rle or len(delta_raw_data) <= len(delta_rle_data)
-                delta_image_data = delta_raw_data if delta_use_raw_this_frame else delta_rle_data
+                (delta_compression, delta_image_data) = _compress(delta_graphic_data[1])
 
-                # If the size of the delta frame (plus delta descriptor) is smaller than the original, use that instead
+                # If the size of the delta frame (plus delta descriptors) is smaller than the original, use that instead
                 # This ensures that if a non-delta is overall smaller in size, we use that in preference due to flash
                 # sizing constraints.
-                if (len(delta_image_data) + QGFFrameDeltaDescriptorV1.length) < len(image_data):
+                if (len(delta_image_data) + delta_extra_length) < len(image_data):
                     # Copy across all the delta equivalents so that the rest of the processing acts on those
                     this_frame = delta_frame
                     location = delta_location
                     size = delta_size
                     converted = delta_converted
                     graphic_data = delta_graphic_data
-                    raw_data = delta_raw_data
-                    rle_data = delta_rle_data
-                    use_raw_this_frame = delta_use_raw_this_frame
+                    compression = delta_compression
                     image_data = delta_image_data
                     use_delta_this_frame = True
 
@@ -345,9 +427,10 @@ def _save(im, fp, filename):
         vprint(f'{f"Frame {idx:3d} base":26s} {fp.tell():5d}d / {fp.tell():04X}h')
         frame_descriptor = QGFFrameDescriptorV1()
         frame_descriptor.is_delta = use_delta_this_frame
+        frame_descriptor.has_delta_tiles = use_delta_this_frame and delta_tiles is not None
         frame_descriptor.is_transparent = False
         frame_descriptor.format = format['image_format_byte']
-        frame_descriptor.compression = 0x00 if use_raw_this_frame else 0x01  # See qp.h, painter_compression_t
+        frame_descriptor.compression = compression
         frame_descriptor.delay = frame.info['duration'] if 'duration' in frame.info else 1000  # If we're not an animation, just pretend we're delaying for 1000ms
         frame_descriptor.write(fp)
 
@@ -379,6 +462,11 @@ def _save(im, fp, filename):
             vprint(f'{f"Frame {idx:3d} delta":26s} {fp.tell():5d}d / {fp.tell():04X}h')
             delta_descriptor.write(fp)
 
+            # Write out which tiles of the delta frame are present, if it was split up
+            if delta_tiles is not None:
+                vprint(f'{f"Frame {idx:3d} delta tiles":26s} {fp.tell():5d}d / {fp.tell():04X}h')
+                delta_tiles.write(fp)
+
         # Write out the data for this frame to the output
         data_descriptor = QGFFrameDataDescriptorV1()
         data_descriptor.data = image_data
@@ -264,6 +264,16 @@ def test_generate_rgb_breathe_table():
     assert 'Breathing max:    127' in result.stdout
 
 
+def test_generate_rgb_gamma_lut():
+    result = check_subcommand('generate-rgb-gamma-lut', '-g', '2', '--red', '200')
+    check_returncode(result)
+    assert 'Gamma:     2.00' in result.stdout
+    assert 'Red max:   200' in result.stdout
+    assert 'rgb_matrix_gamma_lut[3][256]' in result.stdout
+    assert '{ // red\n        0x00, 0x00,' in result.stdout
+    assert '0xC6, 0xC8\n    },' in result.stdout
+
+
 def test_generate_config_h():
     result = check_subcommand('generate-config-h', '-kb', 'handwired/pytest/basic')
     check_returncode(result)
@@ -151,6 +151,15 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+// No DMA, so the transfer has always completed by the time this returns
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    return spi_transmit(data, length);
+}
+
+spi_status_t spi_wait(void) {
+    return SPI_STATUS_SUCCESS;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spi_status_t status;
 
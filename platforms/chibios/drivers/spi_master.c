@@ -277,12 +277,29 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_wait(void) {
+    // Waits the same way spiSend() does -- the completion ISR resumes the suspended thread, and holding the lock while
+    // checking the state means the ISR can't slip in between the check and the suspend
+    osalSysLock();
+    if (SPI_DRIVER.state == SPI_ACTIVE) {
+        (void)osalThreadSuspendS(&SPI_DRIVER.thread);
+    }
+    osalSysUnlock();
+    return SPI_STATUS_SUCCESS;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
+    spi_wait();
     if (currentSlavePin != NO_PIN) {
         spiUnselect(&SPI_DRIVER);
         spiStop(&SPI_DRIVER);
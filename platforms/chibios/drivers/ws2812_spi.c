@@ -1,6 +1,8 @@
 #include "ws2812.h"
+#include "ws2812_spi_encode.h"
 #include "gpio.h"
 #include "util.h"
+#include <string.h>
 #include "chibios_config.h"
 
 /* Adapted from https://github.com/gamazeps/ws2812b-chibios-SPIDMA/ */
@@ -75,67 +77,39 @@
 #    define WS2812_SCK_OUTPUT_MODE PAL_MODE_ALTERNATE(WS2812_SPI_SCK_PAL_MODE) | PAL_OUTPUT_TYPE_PUSHPULL
 #endif
 
-#define BYTES_FOR_LED_BYTE 4
-#ifdef RGBW
-#    define WS2812_CHANNELS 4
-#else
-#    define WS2812_CHANNELS 3
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+#    ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
+#        error "WS2812_SPI_DOUBLE_BUFFER cannot be used together with WS2812_SPI_USE_CIRCULAR_BUFFER"
+#    endif
+// Number of LEDs encoded per call to ws2812_task()
+#    ifndef WS2812_SPI_ENCODE_CHUNK
+#        define WS2812_SPI_ENCODE_CHUNK 16
+#    endif
 #endif
-#define BYTES_FOR_LED (BYTES_FOR_LED_BYTE * WS2812_CHANNELS)
-#define DATA_SIZE (BYTES_FOR_LED * WS2812_LED_COUNT)
+
+#define DATA_SIZE (WS2812_SPI_BYTES_PER_LED * WS2812_LED_COUNT)
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
-
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
-
-/*
- * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
- * the ws2812b protocol, we use this helper function to translate bytes into
- * 0s and 1s for the LED (with the appropriate timing).
- */
-static uint8_t get_protocol_eq(uint8_t data, int pos) {
-    uint8_t eq = 0;
-    if (data & (1 << (2 * (3 - pos))))
-        eq = 0b1110;
-    else
-        eq = 0b1000;
-    if (data & (2 << (2 * (3 - pos))))
-        eq += 0b11100000;
-    else
-        eq += 0b10000000;
-    return eq;
-}
-
-static void set_led_color_rgb(LED_TYPE color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
-
-#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.b, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.r, j);
-#endif
-#ifdef RGBW
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 4 + j] = get_protocol_eq(color.w, j);
+#define TXBUF_SIZE (PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE)
+
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+// One buffer is sent by DMA while the next frame is encoded into the other
+static uint8_t  txbufs[2][TXBUF_SIZE] = {0};
+static uint8_t *txbuf      = txbufs[0]; // frame being encoded
+static uint8_t *txbuf_sent = txbufs[1]; // frame being sent
+
+// Frames are drawn into the back buffer and copied out when committed, so
+// drawing the next frame never changes one that is partly encoded
+static LED_TYPE back_buffer[WS2812_LED_COUNT];
+static LED_TYPE encode_buffer[WS2812_LED_COUNT];
+static uint16_t encode_leds      = 0;     // LEDs in the frame being encoded
+static uint16_t encode_pos       = 0;     // next LED of the committed frame to encode
+static bool     frame_pending    = false; // a committed frame has not been sent yet
+static uint16_t queued_leds      = 0;     // LEDs in a frame committed while the previous one was pending
+static bool     frame_queued     = false; // commit the back buffer again once the pending frame has been sent
+#else
+static uint8_t txbuf[TXBUF_SIZE] = {0};
 #endif
-}
 
 void ws2812_init(void) {
     palSetLineMode(WS2812_DI_PIN, WS2812_MOSI_OUTPUT_MODE);
@@ -187,24 +161,94 @@ void ws2812_init(void) {
 #endif
 }
 
-void ws2812_setleds(LED_TYPE* ledarray, uint16_t leds) {
+static void ws2812_lazy_init(void) {
     static bool s_init = false;
     if (!s_init) {
         ws2812_init();
         s_init = true;
     }
+}
+
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+LED_TYPE *ws2812_back_buffer(void) {
+    return back_buffer;
+}
+
+void ws2812_swap(uint16_t leds) {
+    // Keyboards that only use the back buffer never call ws2812_setleds()
+    ws2812_lazy_init();
+
+    if (leds > WS2812_LED_COUNT) {
+        leds = WS2812_LED_COUNT;
+    }
+    // Restarting a frame part way through would never finish if frames are committed faster than they can be
+    // encoded, so swaps are coalesced until the pending frame has gone out
+    if (frame_pending) {
+        queued_leds  = leds;
+        frame_queued = true;
+        return;
+    }
+    memcpy(encode_buffer, back_buffer, leds * sizeof(LED_TYPE));
+    encode_leds   = leds;
+    encode_pos    = 0;
+    frame_pending = true;
+}
 
-    for (uint8_t i = 0; i < leds; i++) {
-        set_led_color_rgb(ledarray[i], i);
+bool ws2812_task(void) {
+    if (!frame_pending) {
+        return false;
     }
 
+    if (encode_pos < encode_leds) {
+        uint16_t count = encode_leds - encode_pos;
+        if (count > WS2812_SPI_ENCODE_CHUNK) {
+            count = WS2812_SPI_ENCODE_CHUNK;
+        }
+        ws2812_spi_encode_leds(&encode_buffer[encode_pos], count, &txbuf[PREAMBLE_SIZE + WS2812_SPI_BYTES_PER_LED * encode_pos]);
+        encode_pos += count;
+        return true;
+    }
+
+    // Fully encoded, wait for the previous frame to finish going out
+    if (WS2812_SPI.state != SPI_READY) {
+        return true;
+    }
+
+    uint8_t *swap = txbuf_sent;
+    txbuf_sent    = txbuf;
+    txbuf         = swap;
+    frame_pending = false;
+    spiStartSend(&WS2812_SPI, TXBUF_SIZE, txbuf_sent);
+
+    // Start on the latest frame committed while this one was pending
+    if (frame_queued) {
+        frame_queued = false;
+        ws2812_swap(queued_leds);
+    }
+    return frame_pending;
+}
+#endif
+
+void ws2812_setleds(LED_TYPE* ledarray, uint16_t leds) {
+    ws2812_lazy_init();
+
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+    if (leds > WS2812_LED_COUNT) {
+        leds = WS2812_LED_COUNT;
+    }
+    memcpy(back_buffer, ledarray, leds * sizeof(LED_TYPE));
+    ws2812_swap(leds);
+#else
+    ws2812_spi_encode_leds(ledarray, leds, &txbuf[PREAMBLE_SIZE]);
+
     // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
     // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
-#ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
-#    ifdef WS2812_SPI_SYNC
+#    ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
+#        ifdef WS2812_SPI_SYNC
     spiSend(&WS2812_SPI, ARRAY_SIZE(txbuf), txbuf);
-#    else
+#        else
     spiStartSend(&WS2812_SPI, ARRAY_SIZE(txbuf), txbuf);
+#        endif
 #    endif
 #endif
 }
@@ -0,0 +1,95 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "effect_bench.h"
+
+#define EFFECT_BENCH_MAX_FRAME 1024
+
+void advance_time(uint32_t ms);
+
+static uint8_t  last_frame[EFFECT_BENCH_MAX_FRAME];
+static size_t   last_frame_size = 0;
+static uint32_t frame_count     = 0;
+static uint32_t checksum        = 0;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+void effect_bench_record(const void *frame, size_t size) {
+    const uint8_t *bytes = frame;
+    for (size_t i = 0; i < size; i++) {
+        checksum = (checksum ^ bytes[i]) * 16777619u;
+    }
+    if (size > EFFECT_BENCH_MAX_FRAME) {
+        size = EFFECT_BENCH_MAX_FRAME;
+    }
+    memcpy(last_frame, frame, size);
+    last_frame_size = size;
+    frame_count++;
+}
+
+const uint8_t *effect_bench_last_frame(size_t *size) {
+    if (size) {
+        *size = last_frame_size;
+    }
+    return last_frame;
+}
+
+void effect_bench_run(const effect_bench_target_t *target, uint8_t mode, uint32_t frames, uint32_t tick_ms, uint32_t press_interval_ms, effect_bench_result_t *result) {
+    memset(result, 0, sizeof(*result));
+    result->mode = mode;
+
+    target->mode(mode);
+    frame_count = 0;
+    checksum    = 2166136261u;
+
+    uint32_t elapsed_ms = 0;
+    uint32_t key        = 0;
+    uint64_t frame_ns   = 0;
+    // Bounded, so an effect that never flushes fails instead of hanging
+    while (frame_count < frames && result->task_calls < frames * 1000) {
+        if (target->press && press_interval_ms && elapsed_ms % press_interval_ms == 0) {
+            uint8_t row = (key / target->cols) % target->rows;
+            uint8_t col = key % target->cols;
+            target->press(row, col, true);
+            target->press(row, col, false);
+            key = key * 7 + 3;
+        }
+
+        uint32_t before = frame_count;
+        uint64_t start  = now_ns();
+        target->task();
+        uint64_t spent = now_ns() - start;
+
+        result->task_calls++;
+        result->total_ns += spent;
+        frame_ns += spent;
+        if (frame_count != before) {
+            if (frame_ns > result->max_frame_ns) {
+                result->max_frame_ns = frame_ns;
+            }
+            frame_ns = 0;
+        }
+
+        advance_time(tick_ms);
+        elapsed_ms += tick_ms;
+    }
+
+    result->frames   = frame_count;
+    result->checksum = checksum;
+}
+
+void effect_bench_print_header(const char *subsystem) {
+    printf("%-11s %5s %7s %7s %12s %12s %10s\n", subsystem, "mode", "frames", "tasks", "avg ns/frame", "max ns/frame", "checksum");
+}
+
+void effect_bench_print(const char *subsystem, const effect_bench_result_t *result) {
+    uint64_t avg = result->frames ? result->total_ns / result->frames : 0;
+    printf("%-11s %5u %7u %7u %12llu %12llu   %08x\n", subsystem, result->mode, result->frames, result->task_calls, (unsigned long long)avg, (unsigned long long)result->max_frame_ns, result->checksum);
+}
@@ -0,0 +1,50 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Host renderer and frame-cost benchmark shared by the LED matrix and RGB matrix tests.
+// The subsystem under test runs on the test timer with a capture driver that hands
+// every flushed frame to effect_bench_record().
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    void (*mode)(uint8_t mode);                            // switch effect without touching EEPROM
+    void (*task)(void);                                    // one pass of the subsystem task
+    void (*press)(uint8_t row, uint8_t col, bool pressed); // keypress hook, may be NULL
+    uint8_t rows;
+    uint8_t cols;
+} effect_bench_target_t;
+
+typedef struct {
+    uint8_t  mode;
+    uint32_t frames;       // frames flushed to the capture driver
+    uint32_t task_calls;   // task passes needed to produce them
+    uint64_t total_ns;     // time spent in the task
+    uint64_t max_frame_ns; // most expensive single frame
+    uint32_t checksum;     // FNV-1a over every captured frame
+} effect_bench_result_t;
+
+// Called by capture drivers from their flush function
+void effect_bench_record(const void *frame, size_t size);
+
+// Returns the last captured frame, and its size in bytes if size is not NULL
+const uint8_t *effect_bench_last_frame(size_t *size);
+
+// Renders frames of mode, advancing the test timer by tick_ms per task pass and
+// pressing a key every press_interval_ms (0 disables keypresses)
+void effect_bench_run(const effect_bench_target_t *target, uint8_t mode, uint32_t frames, uint32_t tick_ms, uint32_t press_interval_ms, effect_bench_result_t *result);
+
+void effect_bench_print_header(const char *subsystem);
+void effect_bench_print(const char *subsystem, const effect_bench_result_t *result);
+
+#ifdef __cplusplus
+}
+#endif
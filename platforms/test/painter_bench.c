@@ -0,0 +1,356 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "painter_bench.h"
+#include "qp_internal.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
+#include "qp_rgb565_surface.h"
+
+typedef struct {
+    painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
+    painter_device_t surface;
+    uint64_t         pixels;
+    uint32_t         viewports;
+    uint64_t         stall_ns;
+    uint32_t         corrupt;
+} painter_bench_device_t;
+
+// A transfer over the simulated link, which lands in the framebuffer once it completes
+typedef struct {
+    bool        pending;
+    const void *data;
+    uint32_t    byte_count;
+    uint64_t    done_ns;
+    uint8_t     sent[PAINTER_BENCH_MAX_WIDTH * PAINTER_BENCH_MAX_HEIGHT * sizeof(uint16_t)];
+} painter_bench_transfer_t;
+
+static uint16_t                 framebuffer[PAINTER_BENCH_MAX_WIDTH * PAINTER_BENCH_MAX_HEIGHT];
+static painter_bench_device_t   device;
+static uint32_t                 link_ns_per_byte;
+static bool                     link_async;
+static painter_bench_transfer_t transfer;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Recording device, forwarding to the surface
+
+static const painter_driver_vtable_t *surface_vtable(void) {
+    return ((painter_driver_t *)device.surface)->driver_vtable;
+}
+
+static bool bench_init(painter_device_t dev, painter_rotation_t rotation) {
+    return surface_vtable()->init(device.surface, rotation);
+}
+
+static bool bench_power(painter_device_t dev, bool power_on) {
+    return surface_vtable()->power(device.surface, power_on);
+}
+
+static bool bench_clear(painter_device_t dev) {
+    return surface_vtable()->clear(device.surface);
+}
+
+static bool bench_flush(painter_device_t dev) {
+    return surface_vtable()->flush(device.surface);
+}
+
+static bool bench_viewport(painter_device_t dev, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    // Panels take the viewport as commands, which can't be sent until the pixel data before them has been
+    qp_comms_wait(dev);
+    device.viewports++;
+    return surface_vtable()->viewport(device.surface, left, top, right, bottom);
+}
+
+static bool bench_pixdata(painter_device_t dev, const void *pixel_data, uint32_t native_pixel_count) {
+    device.pixels += native_pixel_count;
+    if (link_ns_per_byte == 0) {
+        return surface_vtable()->pixdata(device.surface, pixel_data, native_pixel_count);
+    }
+
+    uint32_t byte_count = native_pixel_count * sizeof(uint16_t);
+    return (link_async ? qp_comms_send_async(dev, pixel_data, byte_count) : qp_comms_send(dev, pixel_data, byte_count)) == byte_count;
+}
+
+static bool bench_palette_convert(painter_device_t dev, int16_t palette_size, qp_pixel_t *palette) {
+    return surface_vtable()->palette_convert(device.surface, palette_size, palette);
+}
+
+static bool bench_append_pixels(painter_device_t dev, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    return surface_vtable()->append_pixels(device.surface, target_buffer, palette, pixel_offset, pixel_count, palette_indices);
+}
+
+static bool bench_append_pixdata(painter_device_t dev, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    return surface_vtable()->append_pixdata(device.surface, target_buffer, pixdata_offset, pixdata_byte);
+}
+
+static bool bench_comms_init(painter_device_t dev) {
+    return true;
+}
+
+static bool bench_comms_start(painter_device_t dev) {
+    return true;
+}
+
+static void bench_comms_stop(painter_device_t dev) {}
+
+static uint32_t bench_comms_send_async(painter_device_t dev, const void *data, uint32_t byte_count) {
+    transfer.pending    = true;
+    transfer.data       = data;
+    transfer.byte_count = QP_MIN(byte_count, sizeof(transfer.sent));
+    transfer.done_ns    = now_ns() + (uint64_t)byte_count * link_ns_per_byte;
+    memcpy(transfer.sent, data, transfer.byte_count);
+    return byte_count;
+}
+
+static void bench_comms_wait(painter_device_t dev) {
+    if (!transfer.pending) {
+        return;
+    }
+
+    uint64_t start = now_ns();
+    while (now_ns() < transfer.done_ns) {
+    }
+    device.stall_ns += now_ns() - start;
+
+    // A real panel would have clocked out whatever was in the buffer at the time, so land what's there now
+    if (memcmp(transfer.data, transfer.sent, transfer.byte_count) != 0) {
+        device.corrupt++;
+    }
+    surface_vtable()->pixdata(device.surface, transfer.data, transfer.byte_count / sizeof(uint16_t));
+    transfer.pending = false;
+}
+
+static uint32_t bench_comms_send(painter_device_t dev, const void *data, uint32_t byte_count) {
+    bench_comms_send_async(dev, data, byte_count);
+    bench_comms_wait(dev);
+    return byte_count;
+}
+
+static const painter_driver_vtable_t bench_driver_vtable = {
+    .init            = bench_init,
+    .power           = bench_power,
+    .clear           = bench_clear,
+    .flush           = bench_flush,
+    .viewport        = bench_viewport,
+    .pixdata         = bench_pixdata,
+    .palette_convert = bench_palette_convert,
+    .append_pixels   = bench_append_pixels,
+    .append_pixdata  = bench_append_pixdata,
+};
+
+static const painter_comms_vtable_t bench_comms_vtable = {
+    .comms_init       = bench_comms_init,
+    .comms_start      = bench_comms_start,
+    .comms_stop       = bench_comms_stop,
+    .comms_send       = bench_comms_send,
+    .comms_send_async = bench_comms_send_async,
+    .comms_wait       = bench_comms_wait,
+};
+
+painter_device_t painter_bench_device(uint16_t width, uint16_t height) {
+    if (width > PAINTER_BENCH_MAX_WIDTH || height > PAINTER_BENCH_MAX_HEIGHT) {
+        return NULL;
+    }
+
+    // Surfaces come from a fixed pool, so the one surface is resized rather than recreated
+    if (!device.surface) {
+        device.surface = qp_rgb565_make_surface(width, height, framebuffer);
+        if (!device.surface) {
+            return NULL;
+        }
+    }
+    ((painter_driver_t *)device.surface)->panel_width  = width;
+    ((painter_driver_t *)device.surface)->panel_height = height;
+
+    device.base.driver_vtable         = &bench_driver_vtable;
+    device.base.comms_vtable          = &bench_comms_vtable;
+    device.base.native_bits_per_pixel = 16;
+    device.base.panel_width           = width;
+    device.base.panel_height          = height;
+    device.pixels                     = 0;
+    device.viewports                  = 0;
+    device.stall_ns                   = 0;
+    device.corrupt                    = 0;
+    transfer.pending                  = false;
+    if (!qp_init((painter_device_t)&device, QP_ROTATION_0)) {
+        return NULL;
+    }
+
+    // Palettes converted for a previous device may not match
+    qp_internal_invalidate_palette();
+    return (painter_device_t)&device;
+}
+
+void painter_bench_set_link(uint32_t ns_per_byte, bool async) {
+    link_ns_per_byte = ns_per_byte;
+    link_async       = async;
+}
+
+const uint16_t *painter_bench_framebuffer(void) {
+    return framebuffer;
+}
+
+uint32_t painter_bench_checksum(void) {
+    const uint8_t *bytes = (const uint8_t *)framebuffer;
+    size_t         size  = (size_t)device.base.panel_width * device.base.panel_height * sizeof(uint16_t);
+    uint32_t       hash  = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// PNG export, using stored deflate blocks so no compression library is needed
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & -(crc & 1));
+        }
+    }
+    return crc;
+}
+
+static void put_be32(uint8_t *out, uint32_t value) {
+    out[0] = value >> 24;
+    out[1] = value >> 16;
+    out[2] = value >> 8;
+    out[3] = value;
+}
+
+static bool write_chunk(FILE *f, const char *type, const uint8_t *data, size_t size) {
+    uint8_t header[8];
+    uint8_t footer[4];
+    put_be32(header, size);
+    memcpy(&header[4], type, 4);
+    put_be32(footer, ~crc32_update(crc32_update(0xFFFFFFFFu, &header[4], 4), data, size));
+    return fwrite(header, 1, sizeof(header), f) == sizeof(header) && fwrite(data, 1, size, f) == size && fwrite(footer, 1, sizeof(footer), f) == sizeof(footer);
+}
+
+bool painter_bench_write_png(const char *path) {
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    uint16_t             width        = device.base.panel_width;
+    uint16_t             height       = device.base.panel_height;
+
+    // Each row is a filter byte followed by RGB888 pixels
+    size_t   raw_size = (size_t)height * (1 + width * 3);
+    uint8_t *raw      = malloc(raw_size);
+    if (!raw) {
+        return false;
+    }
+    uint8_t *out = raw;
+    for (uint16_t y = 0; y < height; y++) {
+        *out++ = 0;
+        for (uint16_t x = 0; x < width; x++) {
+            uint16_t rgb565 = __builtin_bswap16(framebuffer[y * width + x]);
+            uint8_t  r      = (rgb565 >> 11) & 0x1F;
+            uint8_t  g      = (rgb565 >> 5) & 0x3F;
+            uint8_t  b      = rgb565 & 0x1F;
+            *out++          = (r << 3) | (r >> 2);
+            *out++          = (g << 2) | (g >> 4);
+            *out++          = (b << 3) | (b >> 2);
+        }
+    }
+
+    // zlib stream: header, stored blocks of up to 65535 bytes, then the adler32 of the raw data
+    size_t   blocks   = (raw_size + 65534) / 65535;
+    size_t   idat_len = 2 + blocks * 5 + raw_size + 4;
+    uint8_t *idat     = malloc(idat_len);
+    if (!idat) {
+        free(raw);
+        return false;
+    }
+    uint8_t *z = idat;
+    *z++       = 0x78;
+    *z++       = 0x01;
+    for (size_t offset = 0; offset < raw_size; offset += 65535) {
+        size_t len = raw_size - offset < 65535 ? raw_size - offset : 65535;
+        *z++       = (offset + len == raw_size) ? 1 : 0;
+        *z++       = len & 0xFF;
+        *z++       = len >> 8;
+        *z++       = ~len & 0xFF;
+        *z++       = (~len >> 8) & 0xFF;
+        memcpy(z, &raw[offset], len);
+        z += len;
+    }
+    uint32_t a = 1, b = 0;
+    for (size_t i = 0; i < raw_size; i++) {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    put_be32(z, (b << 16) | a);
+    free(raw);
+
+    uint8_t ihdr[13] = {0};
+    put_be32(&ihdr[0], width);
+    put_be32(&ihdr[4], height);
+    ihdr[8] = 8; // bit depth
+    ihdr[9] = 2; // truecolor
+
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        free(idat);
+        return false;
+    }
+    bool ok = fwrite(signature, 1, sizeof(signature), f) == sizeof(signature) && write_chunk(f, "IHDR", ihdr, sizeof(ihdr)) && write_chunk(f, "IDAT", idat, idat_len) && write_chunk(f, "IEND", NULL, 0);
+    ok &= fclose(f) == 0;
+    free(idat);
+    return ok;
+}
+
+bool painter_bench_matches_golden(const char *name, uint32_t golden) {
+    uint32_t    checksum = painter_bench_checksum();
+    const char *dir      = getenv("PAINTER_BENCH_OUTPUT");
+    if (checksum != golden || dir) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%s.png", dir ? dir : ".", name);
+        if (painter_bench_write_png(path) && checksum != golden) {
+            printf("%s: checksum %08x doesn't match golden %08x, wrote %s\n", name, checksum, golden, path);
+        }
+    }
+    return checksum == golden;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmark
+
+void painter_bench_run(void (*render)(painter_device_t device, uint32_t iteration), uint32_t iterations, painter_bench_result_t *result) {
+    memset(result, 0, sizeof(*result));
+    painter_bench_device(device.base.panel_width, device.base.panel_height);
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint64_t start = now_ns();
+        render((painter_device_t)&device, i);
+        result->total_ns += now_ns() - start;
+    }
+
+    result->iterations = iterations;
+    result->pixels     = device.pixels;
+    result->viewports  = device.viewports;
+    result->stall_ns   = device.stall_ns;
+    result->corrupt    = device.corrupt;
+    result->checksum   = painter_bench_checksum();
+}
+
+void painter_bench_print_header(void) {
+    printf("%-16s %7s %12s %12s %10s %10s\n", "painter", "iters", "ns/iter", "Mpx/s", "vp/iter", "checksum");
+}
+
+void painter_bench_print(const char *name, const painter_bench_result_t *result) {
+    uint64_t per_iter  = result->iterations ? result->total_ns / result->iterations : 0;
+    double   mpx_per_s = result->total_ns ? (double)result->pixels * 1000.0 / (double)result->total_ns : 0;
+    double   vp_iter   = result->iterations ? (double)result->viewports / result->iterations : 0;
+    printf("%-16s %7u %12llu %12.1f %10.1f   %08x\n", name, result->iterations, (unsigned long long)per_iter, mpx_per_s, vp_iter, result->checksum);
+}
@@ -0,0 +1,62 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Host painter backend and draw benchmark for the Quantum Painter tests.
+// Drawing goes through a recording device which counts the pixel streams before
+// handing them to an RGB565 surface, so the result can be checksummed against a
+// golden value or exported as a PNG for inspection.
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "qp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PAINTER_BENCH_MAX_WIDTH 320
+#define PAINTER_BENCH_MAX_HEIGHT 320
+
+typedef struct {
+    uint32_t iterations; // times the render function was called
+    uint64_t total_ns;   // time spent rendering
+    uint64_t pixels;     // pixels streamed to the framebuffer
+    uint32_t viewports;  // viewport changes
+    uint64_t stall_ns;   // time spent waiting for the simulated link
+    uint32_t corrupt;    // link transfers whose data was overwritten before they completed
+    uint32_t checksum;   // FNV-1a over the framebuffer afterwards
+} painter_bench_result_t;
+
+// Returns the recording device, cleared and initialised at the requested size
+painter_device_t painter_bench_device(uint16_t width, uint16_t height);
+
+// Simulates a panel link taking ns_per_byte to send pixel data, which only lands in the framebuffer once sent. When
+// async, pixel data goes out through qp_comms_send_async() so drawing carries on during the transfer, as with SPI DMA.
+// A ns_per_byte of 0 sends pixel data straight to the framebuffer.
+void painter_bench_set_link(uint32_t ns_per_byte, bool async);
+
+// Returns the framebuffer contents, as byte-swapped RGB565 like the SPI panels use
+const uint16_t *painter_bench_framebuffer(void);
+
+uint32_t painter_bench_checksum(void);
+
+// Writes the framebuffer to path as an 8-bit RGB PNG
+bool painter_bench_write_png(const char *path);
+
+// Compares the framebuffer against a golden checksum. On a mismatch the framebuffer is
+// written to <name>.png so the difference can be seen, in $PAINTER_BENCH_OUTPUT if set,
+// otherwise the working directory. Setting $PAINTER_BENCH_OUTPUT also exports matches.
+bool painter_bench_matches_golden(const char *name, uint32_t golden);
+
+// Clears the framebuffer then calls render iterations times, counting the pixel streams
+void painter_bench_run(void (*render)(painter_device_t device, uint32_t iteration), uint32_t iterations, painter_bench_result_t *result);
+
+void painter_bench_print_header(void);
+void painter_bench_print(const char *name, const painter_bench_result_t *result);
+
+#ifdef __cplusplus
+}
+#endif
@@ -18,6 +18,7 @@
 #include "led_tables.h"
 #include "progmem.h"
 #include "util.h"
+#include <stddef.h>
 
 RGB hsv_to_rgb_impl(HSV hsv, bool use_cie) {
     RGB      rgb;
@@ -109,6 +110,64 @@ RGB hsv_to_rgb_nocie(HSV hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
 
+/* Channel sources for each hue region, indexing into {v, p, q, t}.
+ * Region 6 is only reached by hue 255 and renders the same as region 0.
+ */
+static const uint8_t hsv_region_channels[7][3] PROGMEM = {
+    {0, 3, 1}, {2, 0, 1}, {1, 0, 3}, {1, 2, 0}, {3, 1, 0}, {0, 1, 2}, {0, 3, 1},
+};
+
+static inline RGB hsv_to_rgb_fast(HSV hsv, const uint8_t *curve) {
+    RGB     rgb;
+    uint8_t v = curve ? pgm_read_byte(&curve[hsv.v]) : hsv.v;
+
+    if (hsv.s == 0) {
+        rgb.r = rgb.g = rgb.b = v;
+        return rgb;
+    }
+
+    // floor(h * 6 / 255) without a division, exact for every 8-bit hue
+    uint16_t h6        = hsv.h * 6;
+    uint8_t  region    = (h6 + (h6 >> 8) + 1) >> 8;
+    uint8_t  remainder = (hsv.h * 2 - region * 85) * 3;
+
+    uint8_t channels[4];
+    channels[0] = v;
+    channels[1] = (v * (255 - hsv.s)) >> 8;
+    channels[2] = (v * (255 - ((hsv.s * remainder) >> 8))) >> 8;
+    channels[3] = (v * (255 - ((hsv.s * (255 - remainder)) >> 8))) >> 8;
+
+    const uint8_t *order = hsv_region_channels[region];
+    rgb.r                = channels[pgm_read_byte(&order[0])];
+    rgb.g                = channels[pgm_read_byte(&order[1])];
+    rgb.b                = channels[pgm_read_byte(&order[2])];
+    return rgb;
+}
+
+static void hsv_to_rgb_batch_impl(const HSV *hsv, RGB *rgb, uint16_t count, bool use_cie) {
+    const uint8_t *curve = NULL;
+#ifdef USE_CIE1931_CURVE
+    if (use_cie) {
+        curve = CIE1931_CURVE;
+    }
+#endif
+    for (uint16_t i = 0; i < count; i++) {
+        rgb[i] = hsv_to_rgb_fast(hsv[i], curve);
+    }
+}
+
+void hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint16_t count) {
+#ifdef USE_CIE1931_CURVE
+    hsv_to_rgb_batch_impl(hsv, rgb, count, true);
+#else
+    hsv_to_rgb_batch_impl(hsv, rgb, count, false);
+#endif
+}
+
+void hsv_to_rgb_nocie_batch(const HSV *hsv, RGB *rgb, uint16_t count) {
+    hsv_to_rgb_batch_impl(hsv, rgb, count, false);
+}
+
 #ifdef RGBW
 void convert_rgb_to_rgbw(LED_TYPE *led) {
     // Determine lowest value in all three colors, put that into
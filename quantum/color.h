@@ -145,6 +145,13 @@ typedef struct PACKED {
 
 RGB hsv_to_rgb(HSV hsv);
 RGB hsv_to_rgb_nocie(HSV hsv);
+
+/**
+ * @brief Converts `count` HSV values into `rgb`, producing the same output as
+ * calling `hsv_to_rgb()` (or `hsv_to_rgb_nocie()`) on each element in turn.
+ */
+void hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint16_t count);
+void hsv_to_rgb_nocie_batch(const HSV *hsv, RGB *rgb, uint16_t count);
 #ifdef RGBW
 void convert_rgb_to_rgbw(LED_TYPE *led);
 #endif
@@ -0,0 +1,73 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+}
+
+class ColorTest : public ::testing::Test {};
+
+static void expect_rgb_eq(const RGB &expected, const RGB &actual, const HSV &hsv) {
+    EXPECT_EQ(expected.r, actual.r) << "h=" << +hsv.h << " s=" << +hsv.s << " v=" << +hsv.v;
+    EXPECT_EQ(expected.g, actual.g) << "h=" << +hsv.h << " s=" << +hsv.s << " v=" << +hsv.v;
+    EXPECT_EQ(expected.b, actual.b) << "h=" << +hsv.h << " s=" << +hsv.s << " v=" << +hsv.v;
+}
+
+TEST_F(ColorTest, BatchMatchesScalarForAllValues) {
+    HSV hsv[256];
+    RGB rgb[256];
+
+    for (uint16_t h = 0; h < 256; h++) {
+        for (uint16_t s = 0; s < 256; s++) {
+            for (uint16_t v = 0; v < 256; v++) {
+                hsv[v] = HSV{(uint8_t)h, (uint8_t)s, (uint8_t)v};
+            }
+            hsv_to_rgb_batch(hsv, rgb, 256);
+            for (uint16_t v = 0; v < 256; v++) {
+                RGB expected = hsv_to_rgb(hsv[v]);
+                if (expected.r != rgb[v].r || expected.g != rgb[v].g || expected.b != rgb[v].b) {
+                    expect_rgb_eq(expected, rgb[v], hsv[v]);
+                    return;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(ColorTest, NoCieBatchMatchesScalarForAllValues) {
+    HSV hsv[256];
+    RGB rgb[256];
+
+    for (uint16_t h = 0; h < 256; h++) {
+        for (uint16_t s = 0; s < 256; s++) {
+            for (uint16_t v = 0; v < 256; v++) {
+                hsv[v] = HSV{(uint8_t)h, (uint8_t)s, (uint8_t)v};
+            }
+            hsv_to_rgb_nocie_batch(hsv, rgb, 256);
+            for (uint16_t v = 0; v < 256; v++) {
+                RGB expected = hsv_to_rgb_nocie(hsv[v]);
+                if (expected.r != rgb[v].r || expected.g != rgb[v].g || expected.b != rgb[v].b) {
+                    expect_rgb_eq(expected, rgb[v], hsv[v]);
+                    return;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(ColorTest, BatchHandlesEmptyAndPartialBuffers) {
+    HSV hsv[3] = {{0, 255, 255}, {85, 255, 255}, {170, 255, 255}};
+    RGB rgb[3] = {{0xAA, 0xAA, 0xAA}, {0xAA, 0xAA, 0xAA}, {0xAA, 0xAA, 0xAA}};
+
+    hsv_to_rgb_batch(hsv, rgb, 0);
+    EXPECT_EQ(rgb[0].r, 0xAA);
+
+    hsv_to_rgb_batch(hsv, rgb, 2);
+    expect_rgb_eq(hsv_to_rgb(hsv[0]), rgb[0], hsv[0]);
+    expect_rgb_eq(hsv_to_rgb(hsv[1]), rgb[1], hsv[1]);
+    EXPECT_EQ(rgb[2].r, 0xAA);
+    EXPECT_EQ(rgb[2].g, 0xAA);
+    EXPECT_EQ(rgb[2].b, 0xAA);
+}
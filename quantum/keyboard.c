@@ -57,6 +57,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef RGB_MATRIX_ENABLE
 #    include "rgb_matrix.h"
 #endif
+#if defined(WS2812_DRIVER_SPI) && defined(WS2812_SPI_DOUBLE_BUFFER)
+#    include "ws2812.h"
+#endif
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
 #endif
@@ -662,6 +665,9 @@ void keyboard_task(void) {
 #ifdef RGB_MATRIX_ENABLE
     rgb_matrix_task();
 #endif
+#if defined(WS2812_DRIVER_SPI) && defined(WS2812_SPI_DOUBLE_BUFFER)
+    ws2812_task();
+#endif
 
 #if defined(BACKLIGHT_ENABLE)
 #    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
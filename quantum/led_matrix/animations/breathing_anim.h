@@ -5,9 +5,16 @@ LED_MATRIX_EFFECT(BREATHING)
 bool BREATHING(effect_params_t* params) {
     LED_MATRIX_USE_LIMITS(led_min, led_max);
 
-    uint8_t  val  = led_matrix_eeconfig.val;
-    uint16_t time = scale16by8(g_led_timer, led_matrix_eeconfig.speed / 8);
-    val           = scale8(abs8(sin8(time) - 128) * 2, val);
+    uint8_t  val    = led_matrix_eeconfig.val;
+    uint16_t time   = scale16by8(g_led_timer, led_matrix_eeconfig.speed / 8);
+    uint8_t  breath = abs8(sin8(time) - 128) * 2;
+#        ifdef LED_MATRIX_HW_BREATHING
+    // let the driver dim the whole matrix so the PWM buffer stays untouched
+    if (led_matrix_set_global_brightness(breath)) {
+        breath = UINT8_MAX;
+    }
+#        endif
+    val = scale8(breath, val);
     for (uint8_t i = led_min; i < led_max; i++) {
         LED_MATRIX_TEST_LED_FLAGS();
         led_matrix_set_value(i, val);
@@ -106,6 +106,9 @@ static led_task_states led_task_state    = SYNCING;
 #if LED_MATRIX_TIMEOUT > 0
 static uint32_t led_anykey_timer;
 #endif // LED_MATRIX_TIMEOUT > 0
+#ifdef LED_MATRIX_HW_BREATHING
+static bool led_global_brightness_claimed = false;
+#endif // LED_MATRIX_HW_BREATHING
 
 // double buffers
 static uint32_t led_timer_buffer;
@@ -161,6 +164,22 @@ void led_matrix_update_pwm_buffers(void) {
     led_matrix_driver.flush();
 }
 
+#ifdef LED_MATRIX_HW_BREATHING
+bool led_matrix_set_global_brightness(uint8_t value) {
+    if (!led_matrix_driver.set_global_brightness) {
+        return false;
+    }
+#    ifdef USE_CIE1931_CURVE
+    // the curve is close to a power law, so scaling the current by the
+    // corrected value matches scaling the value before correction
+    value = pgm_read_byte(&CIE1931_CURVE[value]);
+#    endif
+    led_matrix_driver.set_global_brightness(value);
+    led_global_brightness_claimed = true;
+    return true;
+}
+#endif // LED_MATRIX_HW_BREATHING
+
 void led_matrix_set_value(int index, uint8_t value) {
 #ifdef USE_CIE1931_CURVE
     value = pgm_read_byte(&CIE1931_CURVE[value]);
@@ -344,6 +363,14 @@ static void led_task_flush(uint8_t effect) {
     led_last_effect = effect;
     led_last_enable = led_matrix_eeconfig.enable;
 
+#ifdef LED_MATRIX_HW_BREATHING
+    // hand the full range back once no effect drives the global brightness
+    if (!led_global_brightness_claimed) {
+        led_matrix_set_global_brightness(UINT8_MAX);
+    }
+    led_global_brightness_claimed = false;
+#endif // LED_MATRIX_HW_BREATHING
+
     // update pwm buffers
     led_matrix_update_pwm_buffers();
 
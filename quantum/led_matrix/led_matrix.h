@@ -163,6 +163,9 @@ void        led_matrix_decrease_speed_noeeprom(void);
 led_flags_t led_matrix_get_flags(void);
 void        led_matrix_set_flags(led_flags_t flags);
 void        led_matrix_set_flags_noeeprom(led_flags_t flags);
+#ifdef LED_MATRIX_HW_BREATHING
+bool led_matrix_set_global_brightness(uint8_t value);
+#endif
 
 typedef struct {
     /* Perform any initialisation required for the other driver functions to work. */
@@ -174,6 +177,10 @@ typedef struct {
     void (*set_value_all)(uint8_t value);
     /* Flush any buffered changes to the hardware. */
     void (*flush)(void);
+#ifdef LED_MATRIX_HW_BREATHING
+    /* Scale every LED in hardware, 0 (off) to 255 (full), on the next flush. Optional. */
+    void (*set_global_brightness)(uint8_t value);
+#endif
 } led_matrix_driver_t;
 
 static inline bool led_matrix_check_finished_leds(uint8_t led_idx) {
@@ -185,12 +185,16 @@ const led_matrix_driver_t led_matrix_driver = {
 #    elif defined(IS31FL3733)
 static void flush(void) {
     is31fl3733_update_pwm_buffers(LED_DRIVER_ADDR_1, 0);
+    is31fl3733_update_global_current(LED_DRIVER_ADDR_1, 0);
 #        if defined(LED_DRIVER_ADDR_2)
     is31fl3733_update_pwm_buffers(LED_DRIVER_ADDR_2, 1);
+    is31fl3733_update_global_current(LED_DRIVER_ADDR_2, 1);
 #            if defined(LED_DRIVER_ADDR_3)
     is31fl3733_update_pwm_buffers(LED_DRIVER_ADDR_3, 2);
+    is31fl3733_update_global_current(LED_DRIVER_ADDR_3, 2);
 #                if defined(LED_DRIVER_ADDR_4)
     is31fl3733_update_pwm_buffers(LED_DRIVER_ADDR_4, 3);
+    is31fl3733_update_global_current(LED_DRIVER_ADDR_4, 3);
 #                endif
 #            endif
 #        endif
@@ -201,6 +205,9 @@ const led_matrix_driver_t led_matrix_driver = {
     .flush = flush,
     .set_value = is31fl3733_set_value,
     .set_value_all = is31fl3733_set_value_all,
+#        ifdef LED_MATRIX_HW_BREATHING
+    .set_global_brightness = is31fl3733_set_global_current,
+#        endif
 };
 
 #    elif defined(IS31FLCOMMON)
@@ -0,0 +1,60 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "led_matrix.h"
+#include "effect_bench.h"
+}
+
+#define FRAMES 200
+#define TICK_MS 1
+#define PRESS_INTERVAL_MS 150
+
+static const effect_bench_target_t target = {
+    .mode  = led_matrix_mode_noeeprom,
+    .task  = led_matrix_task,
+    .press = process_led_matrix,
+    .rows  = MATRIX_ROWS,
+    .cols  = MATRIX_COLS,
+};
+
+class LedMatrix : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        led_matrix_init();
+        led_matrix_enable_noeeprom();
+        led_matrix_set_val_noeeprom(UINT8_MAX);
+    }
+};
+
+TEST_F(LedMatrix, EveryEffectRenders) {
+    effect_bench_print_header("led_matrix");
+    for (uint8_t mode = LED_MATRIX_SOLID; mode < LED_MATRIX_EFFECT_MAX; mode++) {
+        effect_bench_result_t result;
+        effect_bench_run(&target, mode, FRAMES, TICK_MS, PRESS_INTERVAL_MS, &result);
+        effect_bench_print("led_matrix", &result);
+        EXPECT_EQ(result.frames, FRAMES) << "mode " << (int)mode;
+    }
+}
+
+TEST_F(LedMatrix, FlushesAtTheConfiguredRate) {
+    effect_bench_result_t result;
+    effect_bench_run(&target, LED_MATRIX_SOLID, 10, TICK_MS, 0, &result);
+    // A frame is rendered over several passes, then held until the flush interval has passed
+    EXPECT_GE(result.task_calls, 10 * LED_MATRIX_LED_FLUSH_LIMIT / TICK_MS - LED_MATRIX_LED_FLUSH_LIMIT);
+}
+
+TEST_F(LedMatrix, SolidFillsEveryLed) {
+    effect_bench_result_t result;
+    led_matrix_set_val_noeeprom(100);
+    effect_bench_run(&target, LED_MATRIX_SOLID, 3, TICK_MS, 0, &result);
+
+    size_t         size;
+    const uint8_t *frame = effect_bench_last_frame(&size);
+    ASSERT_EQ(size, LED_MATRIX_LED_COUNT);
+    for (uint8_t i = 0; i < LED_MATRIX_LED_COUNT; i++) {
+        EXPECT_EQ(frame[i], 100) << "led " << (int)i;
+    }
+}
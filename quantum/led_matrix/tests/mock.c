@@ -0,0 +1,64 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "led_matrix.h"
+#include "eeconfig.h"
+#include "effect_bench.h"
+
+// A 4x6 board, with the bottom row as modifiers
+led_config_t g_led_config = {
+    {
+        {0, 1, 2, 3, 4, 5},
+        {6, 7, 8, 9, 10, 11},
+        {12, 13, 14, 15, 16, 17},
+        {18, 19, 20, 21, 22, 23},
+    },
+    {
+        {0, 0}, {44, 0}, {89, 0}, {134, 0}, {179, 0}, {224, 0},
+        {0, 21}, {44, 21}, {89, 21}, {134, 21}, {179, 21}, {224, 21},
+        {0, 42}, {44, 42}, {89, 42}, {134, 42}, {179, 42}, {224, 42},
+        {0, 64}, {44, 64}, {89, 64}, {134, 64}, {179, 64}, {224, 64},
+    },
+    {
+        4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4,
+        1, 1, 1, 1, 1, 1,
+    },
+};
+
+static uint8_t frame[LED_MATRIX_LED_COUNT];
+
+static void capture_init(void) {
+    memset(frame, 0, sizeof(frame));
+}
+
+static void capture_set_value(int index, uint8_t value) {
+    frame[index] = value;
+}
+
+static void capture_set_value_all(uint8_t value) {
+    memset(frame, value, sizeof(frame));
+}
+
+static void capture_flush(void) {
+    effect_bench_record(frame, sizeof(frame));
+}
+
+const led_matrix_driver_t led_matrix_driver = {
+    .init          = capture_init,
+    .set_value     = capture_set_value,
+    .set_value_all = capture_set_value_all,
+    .flush         = capture_flush,
+};
+
+bool is_keyboard_master(void) {
+    return true;
+}
+
+bool eeconfig_is_enabled(void) {
+    return true;
+}
+
+void eeconfig_init(void) {}
@@ -0,0 +1,17 @@
+led_matrix_DEFS := -DLED_MATRIX_ENABLE -DEEPROM_TEST_HARNESS -DNO_PRINT -DNO_DEBUG
+led_matrix_CONFIG := $(QUANTUM_PATH)/led_matrix/tests/config_mock.h
+
+led_matrix_INC := \
+	$(QUANTUM_PATH)/led_matrix \
+	$(QUANTUM_PATH)/led_matrix/animations \
+	$(QUANTUM_PATH)/led_matrix/animations/runners \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)
+
+led_matrix_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/effect_bench.c \
+	$(QUANTUM_PATH)/led_matrix/tests/mock.c \
+	$(QUANTUM_PATH)/led_matrix/tests/led_matrix_tests.cpp \
+	$(QUANTUM_PATH)/led_matrix/led_matrix.c \
+	$(QUANTUM_PATH)/led_matrix/led_matrix_drivers.c
@@ -173,7 +173,7 @@ void qgf_seek_to_frame_descriptor(qp_stream_t *stream, uint16_t frame_number) {
     qp_stream_setpos(stream, offset);
 }
 
-bool qgf_validate_frame_descriptor(qp_stream_t *stream, uint16_t frame_number, uint8_t *bpp, bool *has_palette, bool *is_delta) {
+bool qgf_validate_frame_descriptor(qp_stream_t *stream, uint16_t frame_number, uint8_t *bpp, bool *has_palette, bool *is_delta, bool *has_delta_tiles) {
     // Seek to the correct location
     qgf_seek_to_frame_descriptor(stream, frame_number);
 
@@ -189,6 +189,15 @@ bool qgf_validate_frame_descriptor(qp_stream_t *stream, uint16_t frame_number, u
         return false;
     }
 
+    // Tiles only make sense as a subdivision of a delta frame
+    if (has_delta_tiles) {
+        *has_delta_tiles = (frame_descriptor.flags & QGF_FRAME_FLAG_DELTA_TILES) == QGF_FRAME_FLAG_DELTA_TILES;
+        if (*has_delta_tiles && !(frame_descriptor.flags & QGF_FRAME_FLAG_DELTA)) {
+            qp_dprintf("Failed to validate frame_descriptor, delta tiles flag set on a non-delta frame\n");
+            return false;
+        }
+    }
+
     return qgf_parse_frame_descriptor(&frame_descriptor, bpp, has_palette, is_delta, NULL, NULL);
 }
 
@@ -211,7 +220,7 @@ bool qgf_validate_palette_descriptor(qp_stream_t *stream, uint16_t frame_number,
     return true;
 }
 
-bool qgf_validate_delta_descriptor(qp_stream_t *stream, uint16_t frame_number) {
+bool qgf_validate_delta_descriptor(qp_stream_t *stream, uint16_t frame_number, bool has_delta_tiles) {
     // Read the delta descriptor
     qgf_delta_v1_t delta_descriptor;
     if (qp_stream_read(&delta_descriptor, sizeof(qgf_delta_v1_t), 1, stream) != 1) {
@@ -224,6 +233,36 @@ bool qgf_validate_delta_descriptor(qp_stream_t *stream, uint16_t frame_number) {
         return false;
     }
 
+    // Right and bottom are inclusive
+    if (delta_descriptor.right < delta_descriptor.left || delta_descriptor.bottom < delta_descriptor.top) {
+        qp_dprintf("Failed to validate delta_descriptor, invalid rectangle (%d,%d)-(%d,%d)\n", (int)delta_descriptor.left, (int)delta_descriptor.top, (int)delta_descriptor.right, (int)delta_descriptor.bottom);
+        return false;
+    }
+
+    if (has_delta_tiles) {
+        // Read the delta tiles descriptor
+        qgf_delta_tiles_v1_t tiles_descriptor;
+        if (qp_stream_read(&tiles_descriptor, sizeof(qgf_delta_tiles_v1_t), 1, stream) != 1) {
+            qp_dprintf("Failed to read delta_tiles_descriptor, expected length was not %d\n", (int)sizeof(qgf_delta_tiles_v1_t));
+            return false;
+        }
+
+        if (tiles_descriptor.tile_width == 0 || tiles_descriptor.tile_height == 0) {
+            qp_dprintf("Failed to validate delta_tiles_descriptor, tile size was %dx%d\n", (int)tiles_descriptor.tile_width, (int)tiles_descriptor.tile_height);
+            return false;
+        }
+
+        // Make sure this block is valid -- there's one bit for each tile covering the delta rectangle
+        uint32_t tile_count     = (uint32_t)QGF_DELTA_TILE_COUNT(delta_descriptor.right - delta_descriptor.left + 1, tiles_descriptor.tile_width) * QGF_DELTA_TILE_COUNT(delta_descriptor.bottom - delta_descriptor.top + 1, tiles_descriptor.tile_height);
+        uint32_t bitmask_length = (tile_count + 7) / 8;
+        if (!qgf_validate_block_header(&tiles_descriptor.header, QGF_FRAME_DELTA_TILES_DESCRIPTOR_TYPEID, (sizeof(qgf_delta_tiles_v1_t) - sizeof(qgf_block_header_v1_t)) + bitmask_length)) {
+            return false;
+        }
+
+        // Move forward in the stream to the next block
+        qp_stream_seek(stream, bitmask_length, SEEK_CUR);
+    }
+
     return true;
 }
 
@@ -254,7 +293,8 @@ bool qgf_validate_stream(qp_stream_t *stream) {
         uint8_t bpp;
         bool    has_palette;
         bool    has_delta;
-        if (!qgf_validate_frame_descriptor(stream, i, &bpp, &has_palette, &has_delta)) {
+        bool    has_delta_tiles;
+        if (!qgf_validate_frame_descriptor(stream, i, &bpp, &has_palette, &has_delta, &has_delta_tiles)) {
             return false;
         }
 
@@ -264,7 +304,7 @@ bool qgf_validate_stream(qp_stream_t *stream) {
         }
 
         // If we've got a delta block, check it
-        if (has_delta && !qgf_validate_delta_descriptor(stream, i)) {
+        if (has_delta && !qgf_validate_delta_descriptor(stream, i, has_delta_tiles)) {
             return false;
         }
 
@@ -74,6 +74,7 @@ typedef struct QP_PACKED qgf_frame_v1_t {
 
 _Static_assert(sizeof(qgf_frame_v1_t) == (sizeof(qgf_block_header_v1_t) + 6), "qgf_frame_v1_t must be 11 bytes in v1 of QGF");
 
+#define QGF_FRAME_FLAG_DELTA_TILES 0x04
 #define QGF_FRAME_FLAG_DELTA 0x02
 #define QGF_FRAME_FLAG_TRANSPARENT 0x01
 
@@ -112,6 +113,23 @@ typedef struct QP_PACKED qgf_delta_v1_t {
 
 _Static_assert(sizeof(qgf_delta_v1_t) == (sizeof(qgf_block_header_v1_t) + 8), "qgf_delta_v1_t must be 13 bytes in v1 of QGF");
 
+/////////////////////////////////////////
+// Frame delta tiles descriptor
+
+#define QGF_FRAME_DELTA_TILES_DESCRIPTOR_TYPEID 0x06
+
+typedef struct QP_PACKED qgf_delta_tiles_v1_t {
+    qgf_block_header_v1_t header;      // = { .type_id = 0x06, .neg_type_id = (~0x06), .length = (2 + N) }
+    uint8_t               tile_width;  // The width of each tile, in pixels
+    uint8_t               tile_height; // The height of each tile, in pixels
+    uint8_t               present[0];  // N bytes of bitmask, one bit per tile of the delta rectangle in row-major order, LSb first
+} qgf_delta_tiles_v1_t;
+
+_Static_assert(sizeof(qgf_delta_tiles_v1_t) == (sizeof(qgf_block_header_v1_t) + 2), "qgf_delta_tiles_v1_t must be 7 bytes in v1 of QGF");
+
+// Number of tiles needed to cover a span of pixels
+#define QGF_DELTA_TILE_COUNT(pixels, tile_size) (((pixels) + (tile_size)-1) / (tile_size))
+
 /////////////////////////////////////////
 // Frame data descriptor
 
@@ -56,6 +56,24 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+/**
+ * @def This controls the number of rendered glyphs kept in RAM, so that drawing the same glyph again in the same colors
+ *      on the same display is a straight copy rather than a decode from the font. Each entry requires
+ *      \ref QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE bytes of RAM, and enabling the cache also keeps a table of ASCII glyph
+ *      widths for each loaded font. Defaults to 0, which disables the cache.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES 0
+#endif
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE
+/**
+ * @def This controls the maximum size in bytes of a single cached glyph, in the display's native pixel format. Glyphs
+ *      larger than this, or larger than the pixel data buffer, are always decoded from the font.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE 512
+#endif
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -72,6 +90,24 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT
+/**
+ * @def This controls the number of pixel data buffers. With 2, the next block of pixels can be prepared while the
+ *      previous one is still being transmitted by a display using asynchronous comms, such as SPI with DMA. Each
+ *      buffer requires QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE bytes of RAM.
+ */
+#    define QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT 1
+#endif
+
+#ifndef QUANTUM_PAINTER_DECODE_SPAN_SIZE
+/**
+ * @def This controls the maximum number of pixels decoded from an image or font in one go before being handed to the
+ *      driver. The span is held on the stack during rendering; larger values mean fewer driver calls per image. Must
+ *      be a multiple of 8.
+ */
+#    define QUANTUM_PAINTER_DECODE_SPAN_SIZE 64
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -462,6 +498,12 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
 #    define RGB565_SURFACE_NUM_DEVICES 0
 #endif // QUANTUM_PAINTER_RGB565_SURFACE_ENABLE
 
+#ifdef QUANTUM_PAINTER_PALETTE_SURFACE_ENABLE
+#    include "qp_palette_surface.h"
+#else // QUANTUM_PAINTER_PALETTE_SURFACE_ENABLE
+#    define PALETTE_SURFACE_NUM_DEVICES 0
+#endif // QUANTUM_PAINTER_PALETTE_SURFACE_ENABLE
+
 #ifdef QUANTUM_PAINTER_ILI9163_ENABLE
 #    include "qp_ili9163.h"
 #else // QUANTUM_PAINTER_ILI9163_ENABLE
@@ -33,6 +33,7 @@ void qp_comms_stop(painter_device_t device) {
         return;
     }
 
+    qp_comms_wait(device);
     driver->comms_vtable->comms_stop(device);
 }
 
@@ -43,15 +44,45 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
         return false;
     }
 
+    qp_comms_wait(device);
     return driver->comms_vtable->comms_send(device, data, byte_count);
 }
 
+// Only one asynchronous transfer is in flight at a time -- anything else sent through the comms APIs waits for it first.
+uint32_t qp_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_comms_send_async: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    if (!driver->comms_vtable->comms_send_async) {
+        return driver->comms_vtable->comms_send(device, data, byte_count);
+    }
+
+    qp_comms_wait(device);
+    return driver->comms_vtable->comms_send_async(device, data, byte_count);
+}
+
+void qp_comms_wait(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_comms_wait: fail (validation_ok == false)\n");
+        return;
+    }
+
+    if (driver->comms_vtable->comms_wait) {
+        driver->comms_vtable->comms_wait(device);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
 void qp_comms_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *                   driver       = (painter_driver_t *)device;
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
+    qp_comms_wait(device);
     comms_vtable->send_command(device, cmd);
 }
 
@@ -68,5 +99,6 @@ uint32_t qp_comms_command_databuf(painter_device_t device, uint8_t cmd, const vo
 void qp_comms_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
     painter_driver_t *                   driver       = (painter_driver_t *)device;
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
+    qp_comms_wait(device);
     comms_vtable->bulk_command_sequence(device, sequence, sequence_len);
 }
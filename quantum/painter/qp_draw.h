@@ -9,8 +9,11 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter utility functions
 
-// Global variable used for native pixel data streaming.
-extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+// Global variable used for native pixel data streaming. Points at the pixdata buffer currently being filled.
+extern uint8_t *qp_internal_global_pixdata_buffer;
+
+// Sends the filled pixdata buffer, then moves on to a buffer which is free to be refilled
+bool qp_internal_send_pixdata_buffer(painter_device_t device, uint32_t native_pixel_count);
 
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
@@ -63,16 +66,30 @@ enum qp_internal_rle_mode_t {
     NON_REPEATING_RUN,
 };
 
+// LZ streams refer back to at most this many previously decoded bytes, with matches of at least QP_LZ_MIN_MATCH bytes. The window
+// is shared, so only one LZ stream can be decoded at a time.
+#define QP_LZ_WINDOW_SIZE 256
+#define QP_LZ_MIN_MATCH 3
+
 typedef struct qp_internal_byte_input_state_t {
-    painter_device_t device;
-    qp_stream_t*     src_stream;
-    int16_t          curr;
+    painter_device_t      device;
+    qp_stream_t*          src_stream;
+    painter_compression_t compression;
+    int16_t               curr;
     union {
         // RLE-specific
         struct {
             enum qp_internal_rle_mode_t mode;
             uint8_t                     remain; // number of bytes remaining in the current mode
         } rle;
+        // LZ-specific
+        struct {
+            uint8_t  flags;  // item flags of the current group, shifted down as items are consumed
+            uint8_t  items;  // number of items remaining in the current group
+            uint8_t  offset; // distance back into the window of the current match, minus one
+            uint8_t  pos;    // write position in the window
+            uint16_t remain; // number of bytes remaining in the current match
+        } lz;
     };
 } qp_internal_byte_input_state_t;
 
@@ -84,6 +101,9 @@ typedef struct qp_internal_pixel_output_state_t {
 
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg);
 
+// Appends a run of palette indices to the pixdata buffer with as few append_pixels calls as possible, transmitting whenever the buffer fills
+bool qp_internal_pixel_span_appender(qp_pixel_t* palette, uint8_t* indices, uint32_t count, qp_internal_pixel_output_state_t* state);
+
 typedef struct qp_internal_byte_output_state_t {
     painter_device_t device;
     uint32_t         byte_write_pos;
@@ -93,3 +113,11 @@ typedef struct qp_internal_byte_output_state_t {
 bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg);
 
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression);
+
+// Returns a pointer to up to max_bytes of decompressed data from a prepared input state, stopping early at the end of an RLE run. Data is either read in place
+// from memory-backed streams or decoded into scratch, with count set to the number of bytes available. Returns NULL on failure. Keeps its own RLE state, so must
+// not be mixed with the byte-at-a-time input callback on the same input state.
+const uint8_t* qp_internal_read_span(qp_internal_byte_input_state_t* input_state, uint8_t* scratch, uint16_t max_bytes, uint16_t* count);
+
+// Span-based equivalent of qp_internal_decode_palette() -- decodes up to QUANTUM_PAINTER_DECODE_SPAN_SIZE pixels at a time, appending each span with a single append_pixels call
+bool qp_internal_decode_palette_spans(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_state_t* input_state, qp_pixel_t* palette, qp_internal_pixel_output_state_t* output_state);
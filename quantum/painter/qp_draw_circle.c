@@ -7,23 +7,18 @@
 #include "qp_comms.h"
 #include "qp_draw.h"
 
-// Utilize 8-way symmetry to draw circles
-static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+// Utilize 8-way symmetry to draw circle outlines
+static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety) {
     /*
     Circles have the property of 8-way symmetry, so eight pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
     represented by [centerx,centery].
 
-    For filled circles, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
-
     Two special cases exist and have been optimized:
     1) offsetx == offsety (the final point), makes half the coordinates
-    equivalent, so we can omit them (and the corresponding fill lines)
-    2) offsetx == 0 (the starting point) means that some horizontal lines
-    would be a single pixel in length, so we write individual pixels instead.
-    This also makes half the symmetrical points identical to their twins,
-    so we only need four points or two points and one line
+    equivalent, so we can omit them
+    2) offsetx == 0 (the starting point) makes half the symmetrical points
+    identical to their twins, so we only need four points
     */
 
     int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
@@ -42,80 +37,102 @@ static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uin
         if (!qp_internal_setpixel_impl(device, centerx, ymy)) {
             return false;
         }
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, centery, xmy, centery)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, centery)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, centery)) {
-                return false;
-            }
+        if (!qp_internal_setpixel_impl(device, xpy, centery)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmy, centery)) {
+            return false;
         }
     } else if (offsetx == offsety) {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypy, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymy, xmy, ymy)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymy)) {
-                return false;
-            }
+        if (!qp_internal_setpixel_impl(device, xpy, ypy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmy, ypy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xpy, ymy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmy, ymy)) {
+            return false;
         }
-
     } else {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypx, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymx, xmy, ymx)) {
-                return false;
-            }
+        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xpy, ypx)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmy, ypx)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xpy, ymx)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmy, ymx)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Fills the pair of scanlines [offsety] above and below the center, each [halfwidth] either side of it
+static bool qp_circle_scanline_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t halfwidth, uint16_t offsety) {
+    int16_t xpw = ((int16_t)centerx) + ((int16_t)halfwidth);
+    int16_t xmw = ((int16_t)centerx) - ((int16_t)halfwidth);
+    int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
+    int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
+
+    if (!qp_internal_fillrect_helper_impl(device, xpw, ypy, xmw, ypy)) {
+        return false;
+    }
+    return offsety == 0 || qp_internal_fillrect_helper_impl(device, xpw, ymy, xmw, ymy);
+}
+
+// Draws filled circles one scanline at a time, so each row of the panel is a single viewport and pixel data transfer
+static bool qp_circle_fill_impl(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius) {
+    /*
+    The same midpoint walk as the outline is used, over the octant from the
+    top of the circle. Each step lands on a new pair of rows at +/-xcalc,
+    which span +/-ycalc -- those are filled straight away.
+
+    Several steps can share the rows at +/-ycalc though, so they're only
+    filled once ycalc moves on, using the widest xcalc seen on them. Once
+    xcalc catches up with ycalc those rows are the same ones the first group
+    fills, so they're skipped.
+    */
+
+    int16_t xcalc = 0;
+    int16_t ycalc = (int16_t)radius;
+    int16_t err   = ((5 - (radius >> 2)) >> 2);
+
+    if (!qp_circle_scanline_impl(device, x, y, ycalc, xcalc)) {
+        return false;
+    }
+
+    while (xcalc < ycalc) {
+        xcalc++;
+        if (err < 0) {
+            err += (xcalc << 1) + 1;
         } else {
-            if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymx)) {
+            if (xcalc < ycalc && !qp_circle_scanline_impl(device, x, y, xcalc - 1, ycalc)) {
                 return false;
             }
+            ycalc--;
+            err += ((xcalc - ycalc) << 1) + 1;
+        }
+        if (!qp_circle_scanline_impl(device, x, y, ycalc, xcalc)) {
+            return false;
         }
     }
 
@@ -146,11 +163,11 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
     }
 
     bool ret = true;
-    if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
+    if (filled) {
+        ret = qp_circle_fill_impl(device, x, y, radius);
+    } else if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc)) {
         ret = false;
-    }
-
-    if (ret) {
+    } else {
         while (xcalc < ycalc) {
             xcalc++;
             if (err < 0) {
@@ -159,7 +176,7 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
                 ycalc--;
                 err += ((xcalc - ycalc) << 1) + 1;
             }
-            if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
+            if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc)) {
                 ret = false;
                 break;
             }
@@ -65,6 +65,40 @@ bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, u
     return qp_internal_decode_palette(device, pixel_count, bits_per_pixel, input_callback, input_arg, qp_internal_global_pixel_lookup_table, output_callback, output_arg);
 }
 
+bool qp_internal_decode_palette_spans(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_state_t* input_state, qp_pixel_t* palette, qp_internal_pixel_output_state_t* output_state) {
+    const uint8_t pixel_bitmask    = (1 << bits_per_pixel) - 1;
+    const uint8_t pixels_per_byte  = 8 / bits_per_pixel;
+    uint32_t      remaining_pixels = pixel_count; // don't try to derive from byte_count, we may not use an entire byte
+    uint8_t       indices[QUANTUM_PAINTER_DECODE_SPAN_SIZE];
+    while (remaining_pixels > 0) {
+        // Copied data lands in the tail of the index buffer -- unpacking from the front never overtakes the unread bytes.
+        // Memory-backed assets skip the copy entirely and are unpacked straight from where they're stored.
+        uint16_t       wanted = (QP_MIN(remaining_pixels, QUANTUM_PAINTER_DECODE_SPAN_SIZE) + pixels_per_byte - 1) / pixels_per_byte;
+        uint16_t       count  = 0;
+        const uint8_t* packed = qp_internal_read_span(input_state, &indices[QUANTUM_PAINTER_DECODE_SPAN_SIZE - wanted], wanted, &count);
+        if (!packed || count == 0) {
+            return false;
+        }
+
+        // Unpack every byte in full -- only the final byte of the image can be partially used, and its excess is ignored
+        uint8_t* index = indices;
+        for (uint16_t i = 0; i < count; ++i) {
+            uint8_t byteval = packed[i];
+            for (uint8_t q = 0; q < pixels_per_byte; ++q) {
+                *index++ = byteval & pixel_bitmask;
+                byteval >>= bits_per_pixel;
+            }
+        }
+        uint32_t span_pixels = QP_MIN(remaining_pixels, (uint32_t)count * pixels_per_byte);
+
+        if (!qp_internal_pixel_span_appender(palette, indices, span_pixels, output_state)) {
+            return false;
+        }
+        remaining_pixels -= span_pixels;
+    }
+    return true;
+}
+
 bool qp_internal_send_bytes(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_byte_output_callback output_callback, void* output_arg) {
     uint32_t remaining_bytes = byte_count;
     while (remaining_bytes > 0) {
@@ -125,6 +159,182 @@ static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     return c;
 }
 
+// Sliding window of the most recently decoded bytes of an LZ stream
+static uint8_t qp_internal_lz_window[QP_LZ_WINDOW_SIZE];
+
+// Reads the next item of an LZ stream, leaving it as a match to be copied out of the window. Literals are written to
+// the window up front, and become a one-byte match against themselves -- QP_LZ_WINDOW_SIZE bytes back is the same slot.
+static bool qp_drawimage_lz_next_item(qp_internal_byte_input_state_t* state) {
+    // Each group of eight items starts with a byte of flags, LSb first, set bits denoting matches
+    if (state->lz.items == 0) {
+        int16_t flags = qp_stream_get(state->src_stream);
+        if (flags < 0) {
+            return false;
+        }
+        state->lz.flags = flags;
+        state->lz.items = 8;
+    }
+    bool is_match = state->lz.flags & 1;
+    state->lz.flags >>= 1;
+    state->lz.items--;
+
+    if (is_match) {
+        int16_t offset = qp_stream_get(state->src_stream);
+        int16_t length = qp_stream_get(state->src_stream);
+        if (offset < 0 || length < 0) {
+            return false;
+        }
+        state->lz.offset = offset;
+        state->lz.remain = length + QP_LZ_MIN_MATCH;
+    } else {
+        int16_t c = qp_stream_get(state->src_stream);
+        if (c < 0) {
+            return false;
+        }
+        qp_internal_lz_window[state->lz.pos] = c;
+        state->lz.offset                     = QP_LZ_WINDOW_SIZE - 1;
+        state->lz.remain                     = 1;
+    }
+    return true;
+}
+
+static inline int16_t qp_drawimage_byte_lz_decoder(void* cb_arg) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
+    if (state->lz.remain == 0 && !qp_drawimage_lz_next_item(state)) {
+        return -1;
+    }
+
+    // Copy the next byte of the match, which may overlap the bytes being written
+    uint8_t c                              = qp_internal_lz_window[(uint8_t)(state->lz.pos - state->lz.offset - 1)];
+    qp_internal_lz_window[state->lz.pos++] = c;
+    state->lz.remain--;
+    state->curr = c;
+    return c;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Progressive pull of spans, push of pixel runs
+
+static const uint8_t* qp_drawimage_span_uncompressed_decoder(qp_internal_byte_input_state_t* state, uint8_t* scratch, uint16_t max_bytes, uint16_t* count) {
+    uint32_t       read = 0;
+    const uint8_t* span = qp_stream_read_span(state->src_stream, scratch, max_bytes, &read);
+    *count              = read;
+    return span;
+}
+
+static const uint8_t* qp_drawimage_span_rle_decoder(qp_internal_byte_input_state_t* state, uint8_t* scratch, uint16_t max_bytes, uint16_t* count) {
+    // Work out if we're parsing the initial marker byte
+    if (state->rle.mode == MARKER_BYTE) {
+        int16_t c = qp_stream_get(state->src_stream);
+        if (c < 0) {
+            return NULL;
+        }
+        if (c >= 128) {
+            state->rle.mode   = NON_REPEATING_RUN; // non-repeated run
+            state->rle.remain = c - 127;
+        } else {
+            state->rle.mode   = REPEATING_RUN; // repeated run
+            state->rle.remain = c;
+            state->curr       = qp_stream_get(state->src_stream);
+            if (state->rle.remain == 0 || state->curr < 0) {
+                return NULL;
+            }
+        }
+    }
+
+    // Hand back as much of the current run as was asked for. Unlike qp_drawimage_byte_rle_decoder(), bytes of a
+    // non-repeating run are not queued up in advance -- they're taken straight from the stream.
+    const uint8_t* span;
+    uint32_t       read = QP_MIN(state->rle.remain, max_bytes);
+    if (state->rle.mode == REPEATING_RUN) {
+        memset(scratch, state->curr, read);
+        span = scratch;
+    } else {
+        span = qp_stream_read_span(state->src_stream, scratch, read, &read);
+        if (!span) {
+            return NULL;
+        }
+    }
+
+    // Decrement the counter of the bytes remaining, swapping back to querying the marker byte mode at the end of the run
+    state->rle.remain -= read;
+    if (state->rle.remain == 0) {
+        state->rle.mode = MARKER_BYTE;
+    }
+
+    *count = read;
+    return span;
+}
+
+static const uint8_t* qp_drawimage_span_lz_decoder(qp_internal_byte_input_state_t* state, uint8_t* scratch, uint16_t max_bytes, uint16_t* count) {
+    // Matches are copied out of the window a byte at a time, as they may overlap the bytes being written
+    uint16_t read = 0;
+    uint8_t  pos  = state->lz.pos;
+    while (read < max_bytes) {
+        if (state->lz.remain == 0) {
+            state->lz.pos = pos;
+            if (!qp_drawimage_lz_next_item(state)) {
+                break;
+            }
+        }
+
+        uint16_t chunk = QP_MIN(state->lz.remain, max_bytes - read);
+        uint8_t  src   = pos - state->lz.offset - 1;
+        for (uint16_t i = 0; i < chunk; ++i) {
+            uint8_t c                    = qp_internal_lz_window[src++];
+            qp_internal_lz_window[pos++] = c;
+            scratch[read++]              = c;
+        }
+        state->lz.remain -= chunk;
+    }
+    state->lz.pos = pos;
+
+    if (read == 0) {
+        return NULL;
+    }
+
+    *count = read;
+    return scratch;
+}
+
+const uint8_t* qp_internal_read_span(qp_internal_byte_input_state_t* input_state, uint8_t* scratch, uint16_t max_bytes, uint16_t* count) {
+    switch (input_state->compression) {
+        case IMAGE_UNCOMPRESSED:
+            return qp_drawimage_span_uncompressed_decoder(input_state, scratch, max_bytes, count);
+        case IMAGE_COMPRESSED_RLE:
+            return qp_drawimage_span_rle_decoder(input_state, scratch, max_bytes, count);
+        case IMAGE_COMPRESSED_LZ:
+            return qp_drawimage_span_lz_decoder(input_state, scratch, max_bytes, count);
+        default:
+            return NULL;
+    }
+}
+
+bool qp_internal_pixel_span_appender(qp_pixel_t* palette, uint8_t* indices, uint32_t count, qp_internal_pixel_output_state_t* state) {
+    painter_driver_t* driver = (painter_driver_t*)state->device;
+
+    while (count > 0) {
+        // Append as much of the span as fits in the remainder of the pixdata buffer
+        uint32_t chunk = QP_MIN(count, state->max_pixels - state->pixel_write_pos);
+        if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos, chunk, indices)) {
+            return false;
+        }
+        state->pixel_write_pos += chunk;
+        indices += chunk;
+        count -= chunk;
+
+        // If we've hit the transmit limit, send out the entire buffer and reset the write position
+        if (state->pixel_write_pos == state->max_pixels) {
+            if (!qp_internal_send_pixdata_buffer(state->device, state->pixel_write_pos)) {
+                return false;
+            }
+            state->pixel_write_pos = 0;
+        }
+    }
+
+    return true;
+}
+
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
@@ -135,7 +345,7 @@ bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg
 
     // If we've hit the transmit limit, send out the entire buffer and reset the write position
     if (state->pixel_write_pos == state->max_pixels) {
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+        if (!qp_internal_send_pixdata_buffer(state->device, state->pixel_write_pos)) {
             return false;
         }
         state->pixel_write_pos = 0;
@@ -155,7 +365,7 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
     // If we've hit the transmit limit, send out the entire buffer and reset the write position
     if (state->byte_write_pos == state->max_bytes) {
         painter_driver_t* driver = (painter_driver_t*)state->device;
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+        if (!qp_internal_send_pixdata_buffer(state->device, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
             return false;
         }
         state->byte_write_pos = 0;
@@ -165,6 +375,7 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
 }
 
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression) {
+    input_state->compression = compression;
     switch (compression) {
         case IMAGE_UNCOMPRESSED:
             return qp_drawimage_byte_uncompressed_decoder;
@@ -172,6 +383,11 @@ qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte
             input_state->rle.mode   = MARKER_BYTE;
             input_state->rle.remain = 0;
             return qp_drawimage_byte_rle_decoder;
+        case IMAGE_COMPRESSED_LZ:
+            input_state->lz.items  = 0;
+            input_state->lz.pos    = 0;
+            input_state->lz.remain = 0;
+            return qp_drawimage_byte_lz_decoder;
         default:
             return NULL;
     }
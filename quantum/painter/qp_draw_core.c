@@ -8,6 +8,7 @@
 #include "qgf.h"
 
 _Static_assert((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE % 16) == 0, "QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE needs to be a non-zero multiple of 16");
+_Static_assert(QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT > 0, "QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT needs to be at least 1");
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Global variables
@@ -19,8 +20,12 @@ _Static_assert((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIX
 //       **** very likely get artifacts rendered to the screen as a result.                                       ****
 //
 
-// Buffer used for transmitting native pixel data to the downstream device.
-__attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+// Buffers used for transmitting native pixel data to the downstream device.
+__attribute__((__aligned__(4))) static uint8_t qp_internal_pixdata_buffers[QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+uint8_t *                                      qp_internal_global_pixdata_buffer = qp_internal_pixdata_buffers[0];
+#if QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT > 1
+static uint8_t qp_internal_pixdata_buffer_index = 0;
+#endif
 
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
@@ -47,12 +52,29 @@ bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y)
     return driver->driver_vtable->viewport(device, x, y, x, y) && driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, 1);
 }
 
+bool qp_internal_send_pixdata_buffer(painter_device_t device, uint32_t native_pixel_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    bool              ret    = driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, native_pixel_count);
+#if QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT > 1
+    // Only one transfer is in flight at a time, so the next buffer has already been sent
+    qp_internal_pixdata_buffer_index  = (qp_internal_pixdata_buffer_index + 1) % QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT;
+    qp_internal_global_pixdata_buffer = qp_internal_pixdata_buffers[qp_internal_pixdata_buffer_index];
+#else
+    // The same buffer is about to be refilled, so it needs to have been sent
+    qp_comms_wait(device);
+#endif
+    return ret;
+}
+
 // Fills the global native pixel buffer with equivalent pixels matching the supplied HSV
 void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint8_t hue, uint8_t sat, uint8_t val) {
     painter_driver_t *driver            = (painter_driver_t *)device;
     uint32_t          pixels_in_pixdata = qp_internal_num_pixels_in_buffer(device);
     num_pixels                          = QP_MIN(pixels_in_pixdata, num_pixels);
 
+    // Filled shapes resend the same buffer, so it may still be in flight from a previous fill
+    qp_comms_wait(device);
+
     // Convert the color to native pixel format
     qp_pixel_t color = {.hsv888 = {.h = hue, .s = sat, .v = val}};
     driver->driver_vtable->palette_convert(device, 1, &color);
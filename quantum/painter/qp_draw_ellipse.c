@@ -6,17 +6,14 @@
 #include "qp_comms.h"
 #include "qp_draw.h"
 
-// Utilize 4-way symmetry to draw an ellipse
-static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+// Utilize 4-way symmetry to draw an ellipse outline
+static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety) {
     /*
     Ellipses have the property of 4-way symmetry, so four pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
     represented by [centerx,centery].
 
-    For filled ellipses, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
-
-    When offsetx == 0 only two pixels can be drawn for filled or unfilled ellipses
+    When offsetx == 0 only two pixels need to be drawn
     */
 
     int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
@@ -24,33 +21,96 @@ static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, ui
     int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
     int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
 
+    if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
+        return false;
+    }
+    if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
+        return false;
+    }
     if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
-        }
-    } else if (filled) {
-        if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-            return false;
-        }
-        if (offsety > 0 && !qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-            return false;
-        }
-    } else {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
+        return true;
+    }
+    if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
+        return false;
+    }
+    if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
+        return false;
+    }
+
+    return true;
+}
+
+// Fills the pair of scanlines [offsety] above and below the center, each [offsetx] either side of it
+static bool qp_ellipse_scanline_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety) {
+    int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
+    int16_t xmx = ((int16_t)centerx) - ((int16_t)offsetx);
+    int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
+    int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
+
+    if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
+        return false;
+    }
+    return offsety == 0 || qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy);
+}
+
+// Draws filled ellipses one scanline at a time, so each row of the panel is a single viewport and pixel data transfer
+static bool qp_ellipse_fill_impl(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey) {
+    /*
+    The same two regions are walked as for the outline, but in reverse order.
+
+    The region nearest the horizontal axis steps dy every time, so each of
+    its rows is filled straight away. Its widths only ever shrink moving
+    away from the axis, so the last one filled is a lower bound for all of
+    the rows it covered.
+
+    The region nearest the vertical axis can take several steps on the same
+    row, so each row is filled once dy moves on, using the widest dx seen on
+    it. Rows the first region has already filled at least as wide are
+    skipped -- the two regions usually meet on a row or two.
+    */
+
+    int16_t aa = ((int16_t)sizex) * ((int16_t)sizex);
+    int16_t bb = ((int16_t)sizey) * ((int16_t)sizey);
+    int16_t fa = 4 * ((int16_t)aa);
+    int16_t fb = 4 * ((int16_t)bb);
+
+    int16_t dx = sizex;
+    int16_t dy = 0;
+
+    int16_t filled_dx = sizex;
+    int16_t filled_dy = 0;
+    for (int16_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
+        if (!qp_ellipse_scanline_impl(device, x, y, dx, dy)) {
             return false;
         }
-        if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-            return false;
+        filled_dx = dx;
+        filled_dy = dy;
+        if (delta >= 0) {
+            delta += fb * (1 - dx);
+            dx--;
         }
-        if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-            return false;
+        delta += aa * (4 * dy + 6);
+    }
+
+    dx = 0;
+    dy = ((int16_t)sizey);
+
+    int16_t row_dx = -1;
+    for (int16_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
+        row_dx = dx;
+        if (delta >= 0) {
+            if ((dy > filled_dy || row_dx > filled_dx) && !qp_ellipse_scanline_impl(device, x, y, row_dx, dy)) {
+                return false;
+            }
+            row_dx = -1;
+            delta += fa * (1 - dy);
+            dy--;
         }
+        delta += bb * (4 * dx + 6);
+    }
+
+    if (row_dx >= 0 && (dy > filled_dy || row_dx > filled_dx)) {
+        return qp_ellipse_scanline_impl(device, x, y, row_dx, dy);
     }
 
     return true;
@@ -83,31 +143,35 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     }
 
     bool ret = true;
-    for (int16_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
-            ret = false;
-            break;
-        }
-        if (delta >= 0) {
-            delta += fa * (1 - dy);
-            dy--;
+    if (filled) {
+        ret = qp_ellipse_fill_impl(device, x, y, sizex, sizey);
+    } else {
+        for (int16_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
+            if (!qp_ellipse_helper_impl(device, x, y, dx, dy)) {
+                ret = false;
+                break;
+            }
+            if (delta >= 0) {
+                delta += fa * (1 - dy);
+                dy--;
+            }
+            delta += bb * (4 * dx + 6);
         }
-        delta += bb * (4 * dx + 6);
-    }
-
-    dx = sizex;
-    dy = 0;
 
-    for (int16_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
-            ret = false;
-            break;
+        dx = sizex;
+        dy = 0;
+
+        for (int16_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
+            if (!qp_ellipse_helper_impl(device, x, y, dx, dy)) {
+                ret = false;
+                break;
+            }
+            if (delta >= 0) {
+                delta += fb * (1 - dx);
+                dx--;
+            }
+            delta += aa * (4 * dy + 6);
         }
-        if (delta >= 0) {
-            delta += fb * (1 - dx);
-            dx--;
-        }
-        delta += aa * (4 * dy + 6);
     }
 
     qp_dprintf("qp_ellipse: %s\n", ret ? "ok" : "fail");
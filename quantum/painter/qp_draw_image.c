@@ -116,10 +116,14 @@ typedef struct qgf_frame_info_t {
     uint8_t               bpp;
     bool                  has_palette;
     bool                  is_delta;
+    bool                  has_delta_tiles;
     uint16_t              left;
     uint16_t              top;
     uint16_t              right;
     uint16_t              bottom;
+    uint8_t               tile_width;
+    uint8_t               tile_height;
+    uint32_t              tiles_offset; // stream position of the delta tile bitmask
     uint16_t              delay;
 } qgf_frame_info_t;
 
@@ -146,6 +150,7 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
     if (!qgf_parse_frame_descriptor(&frame_descriptor, &info->bpp, &info->has_palette, &info->is_delta, &info->compression_scheme, &info->delay)) {
         return false;
     }
+    info->has_delta_tiles = info->is_delta && (frame_descriptor.flags & QGF_FRAME_FLAG_DELTA_TILES) == QGF_FRAME_FLAG_DELTA_TILES;
 
     // Ensure we aren't reusing any palette
     qp_internal_invalidate_palette();
@@ -194,6 +199,20 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         info->top    = delta_descriptor.top;
         info->right  = delta_descriptor.right;
         info->bottom = delta_descriptor.bottom;
+
+        if (info->has_delta_tiles) {
+            qgf_delta_tiles_v1_t tiles_descriptor;
+            if (qp_stream_read(&tiles_descriptor, sizeof(qgf_delta_tiles_v1_t), 1, &qgf_image->stream) != 1) {
+                qp_dprintf("Failed to read delta_tiles_descriptor, expected length was not %d\n", (int)sizeof(qgf_delta_tiles_v1_t));
+                return false;
+            }
+
+            // The bitmask is read as the tiles are drawn, so just remember where it is
+            info->tile_width   = tiles_descriptor.tile_width;
+            info->tile_height  = tiles_descriptor.tile_height;
+            info->tiles_offset = qp_stream_tell(&qgf_image->stream);
+            qp_stream_seek(&qgf_image->stream, tiles_descriptor.header.length - (sizeof(qgf_delta_tiles_v1_t) - sizeof(qgf_block_header_v1_t)), SEEK_CUR);
+        }
     }
 
     // Read the data block
@@ -207,6 +226,93 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
     return true;
 }
 
+// Draws the next rectangle's worth of pixel data from the stream, as one viewport
+static bool qp_drawimage_rect_impl(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b, qgf_frame_info_t *frame_info, qp_internal_byte_input_state_t *input_state, qp_internal_byte_input_callback input_callback) {
+    painter_driver_t *driver      = (painter_driver_t *)device;
+    uint32_t          pixel_count = ((uint32_t)(r - l + 1)) * (b - t + 1);
+
+    // Configure where we're going to be rendering to
+    if (!driver->driver_vtable->viewport(device, l, t, r, b)) {
+        qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
+        return false;
+    }
+
+    bool ret = false;
+    if (frame_info->bpp <= 8) {
+        // Set up the output state
+        qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
+
+        // Decode the pixel data and stream to the display
+        ret = qp_internal_decode_palette_spans(device, pixel_count, frame_info->bpp, input_state, qp_internal_global_pixel_lookup_table, &output_state);
+        // Any leftovers need transmission as well.
+        if (ret && output_state.pixel_write_pos > 0) {
+            ret &= qp_internal_send_pixdata_buffer(device, output_state.pixel_write_pos);
+        }
+    } else {
+        // Set up the output state
+        qp_internal_byte_output_state_t output_state = {.device = device, .byte_write_pos = 0, .max_bytes = qp_internal_num_pixels_in_buffer(device) * driver->native_bits_per_pixel / 8};
+
+        // Stream the raw pixel data to the display
+        uint32_t byte_count = pixel_count * frame_info->bpp / 8;
+        ret                 = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
+        // Any leftovers need transmission as well.
+        if (ret && output_state.byte_write_pos > 0) {
+            ret &= qp_internal_send_pixdata_buffer(device, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
+        }
+    }
+
+    return ret;
+}
+
+// Draws only the changed tiles of a delta frame. Each horizontal run of changed tiles is stored as its own rectangle,
+// so unchanged tiles cost neither flash nor panel bandwidth.
+static bool qp_drawimage_tiles_impl(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b, qgf_image_handle_t *qgf_image, qgf_frame_info_t *frame_info, qp_internal_byte_input_state_t *input_state, qp_internal_byte_input_callback input_callback) {
+    uint16_t tile_w     = frame_info->tile_width;
+    uint16_t tile_h     = frame_info->tile_height;
+    uint16_t cols       = QGF_DELTA_TILE_COUNT(r - l + 1, tile_w);
+    uint16_t rows       = QGF_DELTA_TILE_COUNT(b - t + 1, tile_h);
+    uint32_t tile_index = 0;
+    uint8_t  present    = 0;
+
+    for (uint16_t row = 0; row < rows; ++row) {
+        uint16_t tile_t = t + row * tile_h;
+        uint16_t tile_b = QP_MIN(tile_t + tile_h - 1, b);
+        uint16_t run    = 0; // consecutive changed tiles ending at the current column
+        for (uint16_t col = 0; col <= cols; ++col) {
+            bool changed = false;
+            if (col < cols) {
+                // The bitmask lives ahead of the pixel data, so hop back to it once every eight tiles
+                if ((tile_index & 7) == 0) {
+                    uint32_t data_pos = qp_stream_tell(&qgf_image->stream);
+                    qp_stream_setpos(&qgf_image->stream, frame_info->tiles_offset + tile_index / 8);
+                    int16_t bits = qp_stream_get(&qgf_image->stream);
+                    qp_stream_setpos(&qgf_image->stream, data_pos);
+                    if (bits < 0) {
+                        qp_dprintf("qp_drawimage_recolor: fail (could not read delta tiles)\n");
+                        return false;
+                    }
+                    present = bits;
+                }
+                changed = present & (1 << (tile_index & 7));
+                ++tile_index;
+            }
+
+            if (changed) {
+                ++run;
+            } else if (run > 0) {
+                uint16_t run_l = l + (col - run) * tile_w;
+                uint16_t run_r = QP_MIN(l + col * tile_w - 1, r);
+                if (!qp_drawimage_rect_impl(device, run_l, tile_t, run_r, tile_b, frame_info, input_state, input_callback)) {
+                    return false;
+                }
+                run = 0;
+            }
+        }
+    }
+
+    return true;
+}
+
 static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
     qp_dprintf("qp_drawimage_recolor: entry\n");
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -227,6 +333,12 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
+    // Prevent stuff like drawing 24bpp images on 16bpp displays
+    if (frame_info->bpp > 8 && frame_info->bpp != driver->native_bits_per_pixel) {
+        qp_dprintf("Image's bpp doesn't match the target display's native_bits_per_pixel\n");
+        return false;
+    }
+
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_drawimage_recolor: fail (could not start comms)\n");
         return false;
@@ -236,22 +348,14 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
     if (frame_info->is_delta) {
         l = x + frame_info->left;
         t = y + frame_info->top;
-        r = x + frame_info->right - 1;
-        b = y + frame_info->bottom - 1;
+        r = x + frame_info->right;
+        b = y + frame_info->bottom;
     } else {
         l = x;
         t = y;
         r = x + image->width - 1;
         b = y + image->height - 1;
     }
-    uint32_t pixel_count = ((uint32_t)(r - l + 1)) * (b - t + 1);
-
-    // Configure where we're going to be rendering to
-    if (!driver->driver_vtable->viewport(device, l, t, r, b)) {
-        qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
-        qp_comms_stop(device);
-        return false;
-    }
 
     // Set up the input state
     qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qgf_image->stream};
@@ -262,32 +366,11 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
-    bool ret = false;
-    if (frame_info->bpp <= 8) {
-        // Set up the output state
-        qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
-
-        // Decode the pixel data and stream to the display
-        ret = qp_internal_decode_palette(device, pixel_count, frame_info->bpp, input_callback, &input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
-        // Any leftovers need transmission as well.
-        if (ret && output_state.pixel_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
-        }
-    } else if (frame_info->bpp != driver->native_bits_per_pixel) {
-        // Prevent stuff like drawing 24bpp images on 16bpp displays
-        qp_dprintf("Image's bpp doesn't match the target display's native_bits_per_pixel\n");
-        return false;
+    bool ret;
+    if (frame_info->has_delta_tiles) {
+        ret = qp_drawimage_tiles_impl(device, l, t, r, b, qgf_image, frame_info, &input_state, input_callback);
     } else {
-        // Set up the output state
-        qp_internal_byte_output_state_t output_state = {.device = device, .byte_write_pos = 0, .max_bytes = qp_internal_num_pixels_in_buffer(device) * driver->native_bits_per_pixel / 8};
-
-        // Stream the raw pixel data to the display
-        uint32_t byte_count = pixel_count * frame_info->bpp / 8;
-        ret                 = qp_internal_send_bytes(device, byte_count, input_callback, &input_state, qp_internal_byte_appender, &output_state);
-        // Any leftovers need transmission as well.
-        if (ret && output_state.byte_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
-        }
+        ret = qp_drawimage_rect_impl(device, l, t, r, b, frame_info, &input_state, input_callback);
     }
 
     qp_dprintf("qp_drawimage_recolor: %s\n", ret ? "ok" : "fail");
@@ -31,6 +31,9 @@ typedef struct qff_font_handle_t {
     bool  owns_buffer;
     void *buffer;
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    uint8_t ascii_widths[95];
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
 } qff_font_handle_t;
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
@@ -105,6 +108,22 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
         return NULL;
     }
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Keep the ASCII glyph widths at hand, so measuring text doesn't need to go back to the font
+    if (font->has_ascii_table) {
+        qp_stream_setpos(&font->stream, sizeof(qff_font_descriptor_v1_t) + sizeof(qgf_block_header_v1_t));
+        for (int i = 0; i < 95; ++i) {
+            qff_ascii_glyph_v1_t glyph_info;
+            if (qp_stream_read(&glyph_info, sizeof(qff_ascii_glyph_v1_t), 1, &font->stream) != 1) {
+                qp_dprintf("qp_load_font: fail (could not read ascii glyph widths)\n");
+                qp_close_font((painter_font_handle_t)font);
+                return NULL;
+            }
+            font->ascii_widths[i] = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
+        }
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
     // Validation success, we can return the handle
     font->validate_ok = true;
     qp_dprintf("qp_load_font: ok\n");
@@ -131,6 +150,78 @@ painter_font_handle_t qp_load_font_mem(const void *buffer) {
     return qp_load_font_internal(font_mem_stream_factory, (void *)buffer);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph cache
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
+typedef struct qp_glyph_cache_entry_t {
+    const qff_font_handle_t *font; // NULL if the entry is unused
+    painter_device_t         device;
+    uint32_t                 code_point;
+    qp_pixel_t               fg_hsv888;
+    qp_pixel_t               bg_hsv888;
+    uint32_t                 last_used;
+    uint8_t                  width;
+    __attribute__((__aligned__(4))) uint8_t pixdata[QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE];
+} qp_glyph_cache_entry_t;
+
+static qp_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES] = {0};
+static uint32_t               glyph_cache_clock                                 = 0;
+
+// Returns the previously-rendered glyph matching the parameters, or NULL if it needs to be decoded from the font
+static qp_glyph_cache_entry_t *qp_glyph_cache_find(const qff_font_handle_t *qff_font, painter_device_t device, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache[i];
+        if (entry->font == qff_font && entry->device == device && entry->code_point == code_point && memcmp(&entry->fg_hsv888.hsv888, &fg_hsv888.hsv888, sizeof(fg_hsv888.hsv888)) == 0 && memcmp(&entry->bg_hsv888.hsv888, &bg_hsv888.hsv888, sizeof(bg_hsv888.hsv888)) == 0) {
+            entry->last_used = ++glyph_cache_clock;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Keeps a copy of a rendered glyph, replacing the least recently used entry if the cache is full
+static void qp_glyph_cache_store(const qff_font_handle_t *qff_font, painter_device_t device, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint8_t width, const uint8_t *pixdata, uint32_t byte_count) {
+    if (byte_count > QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE) {
+        return;
+    }
+
+    qp_glyph_cache_entry_t *entry = &glyph_cache[0];
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (!glyph_cache[i].font) {
+            entry = &glyph_cache[i];
+            break;
+        }
+        if (glyph_cache[i].last_used < entry->last_used) {
+            entry = &glyph_cache[i];
+        }
+    }
+
+    entry->font       = qff_font;
+    entry->device     = device;
+    entry->code_point = code_point;
+    entry->fg_hsv888  = fg_hsv888;
+    entry->bg_hsv888  = bg_hsv888;
+    entry->width      = width;
+    entry->last_used  = ++glyph_cache_clock;
+
+    // The entry being replaced may still be in flight from an earlier redraw
+    qp_comms_wait(device);
+    memcpy(entry->pixdata, pixdata, byte_count);
+}
+
+// Drops any glyphs rendered from the supplied font
+static void qp_glyph_cache_invalidate(const qff_font_handle_t *qff_font) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (glyph_cache[i].font == qff_font) {
+            glyph_cache[i].font = NULL;
+        }
+    }
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_font
 
@@ -150,6 +241,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // The next font loaded into this slot must not pick up this font's glyphs
+    qp_glyph_cache_invalidate(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -160,7 +256,7 @@ bool qp_close_font(painter_font_handle_t font) {
 // Helpers
 
 // Callback to be invoked for each codepoint detected in the UTF8 input string
-typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg);
+typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, void *cb_arg);
 
 // Helper that sets up the palette (if required) and returns the offset in the stream that the data starts
 static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device, qff_font_handle_t *qff_font, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint32_t *data_offset) {
@@ -291,6 +387,17 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
     return false;
 }
 
+// Helper that returns the width of a glyph, without guaranteeing the stream is positioned at its data
+static inline bool qp_drawtext_get_glyph_width(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
+        *width = qff_font->ascii_widths[code_point - 0x20];
+        return true;
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    return qp_drawtext_prepare_glyph_for_render(qff_font, code_point, width);
+}
+
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
 static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const char *str, code_point_handler handler, void *cb_arg) {
     while (*str) {
@@ -301,13 +408,7 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
             return false;
         }
 
-        uint8_t width;
-        if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
-            qp_dprintf("Failed to prepare glyph for rendering.\n");
-            return false;
-        }
-
-        if (!handler(qff_font, code_point, width, qff_font->base.line_height, cb_arg)) {
+        if (!handler(qff_font, code_point, cb_arg)) {
             qp_dprintf("Failed to execute glyph handler.\n");
             return false;
         }
@@ -324,9 +425,15 @@ typedef struct code_point_iter_calcwidth_state_t {
 } code_point_iter_calcwidth_state_t;
 
 // Codepoint handler callback: width calc
-static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, void *cb_arg) {
     code_point_iter_calcwidth_state_t *state = (code_point_iter_calcwidth_state_t *)cb_arg;
 
+    uint8_t width;
+    if (!qp_drawtext_get_glyph_width(qff_font, code_point, &width)) {
+        qp_dprintf("Failed to get glyph width.\n");
+        return false;
+    }
+
     // Increment the overall width by this glyph's width
     state->width += width;
 
@@ -344,15 +451,37 @@ typedef struct code_point_iter_drawglyph_state_t {
     qp_internal_byte_input_callback   input_callback;
     qp_internal_byte_input_state_t *  input_state;
     qp_internal_pixel_output_state_t *output_state;
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    qp_pixel_t fg_hsv888;
+    qp_pixel_t bg_hsv888;
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
 } code_point_iter_drawglyph_state_t;
 
 // Codepoint handler callback: drawing
-static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, void *cb_arg) {
     code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
     painter_driver_t *                 driver = (painter_driver_t *)state->device;
+    uint8_t                            height = qff_font->base.line_height;
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Glyphs rendered previously can be sent straight to the display
+    qp_glyph_cache_entry_t *cached = qp_glyph_cache_find(qff_font, state->device, code_point, state->fg_hsv888, state->bg_hsv888);
+    if (cached) {
+        bool ret = driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + cached->width - 1, state->ypos + height - 1);
+        ret      = ret && driver->driver_vtable->pixdata(state->device, cached->pixdata, ((uint32_t)cached->width) * height);
+        state->xpos += cached->width;
+        return ret;
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
+    uint8_t width;
+    if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+        qp_dprintf("Failed to prepare glyph for rendering.\n");
+        return false;
+    }
 
-    // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
-    state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
+    // Reset the input state's decompression -- the stream has just been positioned at the glyph by qp_drawtext_prepare_glyph_for_render()
+    qp_internal_prepare_input_state(state->input_state, state->input_state->compression);
 
     // Reset the output state
     state->output_state->pixel_write_pos = 0;
@@ -365,11 +494,18 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
 
     // Decode the pixel data for the glyph
     uint32_t pixel_count = ((uint32_t)width) * height;
-    bool     ret         = qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, state->output_state);
+    bool     ret         = qp_internal_decode_palette_spans(state->device, pixel_count, qff_font->bpp, state->input_state, qp_internal_global_pixel_lookup_table, state->output_state);
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Keep a copy of the glyph if it was decoded in one go, i.e. it's still sitting in the pixdata buffer in its entirety
+    if (ret && pixel_count > 0 && state->output_state->pixel_write_pos == pixel_count) {
+        qp_glyph_cache_store(qff_font, state->device, code_point, state->fg_hsv888, state->bg_hsv888, width, qp_internal_global_pixdata_buffer, (pixel_count * driver->native_bits_per_pixel + 7) / 8);
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
 
     // Any leftovers need transmission as well.
     if (ret && state->output_state->pixel_write_pos > 0) {
-        ret &= driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->output_state->pixel_write_pos);
+        ret &= qp_internal_send_pixdata_buffer(state->device, state->output_state->pixel_write_pos);
     }
 
     return ret;
@@ -447,7 +583,14 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
 
     qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Fonts with their own palette render identically whatever colors are requested
+    if (!qff_font->has_palette) {
+        state.fg_hsv888 = fg_hsv888;
+        state.bg_hsv888 = bg_hsv888;
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    uint32_t data_offset;
     if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
         qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
         qp_comms_stop(device);
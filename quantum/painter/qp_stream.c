@@ -9,6 +9,16 @@
 uint32_t qp_stream_read_impl(void *output_buf, uint32_t member_size, uint32_t num_members, qp_stream_t *stream) {
     uint8_t *output_ptr = (uint8_t *)output_buf;
 
+    // Bulk copy if the underlying data is directly accessible
+    if (stream->read_direct) {
+        uint32_t       count = 0;
+        const uint8_t *data  = stream->read_direct(stream, num_members * member_size, &count);
+        if (data) {
+            memcpy(output_ptr, data, count);
+        }
+        return count / member_size;
+    }
+
     uint32_t i;
     for (i = 0; i < (num_members * member_size); ++i) {
         int16_t c = qp_stream_get(stream);
@@ -22,6 +32,15 @@ uint32_t qp_stream_read_impl(void *output_buf, uint32_t member_size, uint32_t nu
     return i / member_size;
 }
 
+const uint8_t *qp_stream_read_span(qp_stream_t *stream, uint8_t *scratch, uint32_t length, uint32_t *count) {
+    if (stream->read_direct) {
+        return stream->read_direct(stream, length, count);
+    }
+
+    *count = qp_stream_read(scratch, 1, length, stream);
+    return *count > 0 ? scratch : NULL;
+}
+
 uint32_t qp_stream_write_impl(const void *input_buf, uint32_t member_size, uint32_t num_members, qp_stream_t *stream) {
     uint8_t *input_ptr = (uint8_t *)input_buf;
 
@@ -109,9 +128,30 @@ static inline void mem_close(qp_stream_t *stream) {
     // No-op.
 }
 
+static inline const uint8_t *mem_read_direct(qp_stream_t *stream, uint32_t length, uint32_t *count) {
+    qp_memory_stream_t *s = (qp_memory_stream_t *)stream;
+    if (s->position >= s->length) {
+        s->is_eof = true;
+        *count    = 0;
+        return NULL;
+    }
+
+    // Mirror mem_get(), running off the end flags EOF
+    const uint8_t *data      = &s->buffer[s->position];
+    uint32_t       remaining = s->length - s->position;
+    if (length > remaining) {
+        length    = remaining;
+        s->is_eof = true;
+    }
+
+    *count = length;
+    s->position += length;
+    return data;
+}
+
 qp_memory_stream_t qp_make_memory_stream(void *buffer, int32_t length) {
     qp_memory_stream_t stream = {
-        .base     = {.get = mem_get, .put = mem_put, .seek = mem_seek, .tell = mem_tell, .is_eof = mem_is_eof, .close = mem_close},
+        .base     = {.get = mem_get, .put = mem_put, .seek = mem_seek, .tell = mem_tell, .is_eof = mem_is_eof, .close = mem_close, .read_direct = mem_read_direct},
         .buffer   = (uint8_t *)buffer,
         .length   = length,
         .position = 0,
@@ -41,6 +41,11 @@ typedef struct qp_stream_t qp_stream_t;
 uint32_t qp_stream_read_impl(void *output_buf, uint32_t member_size, uint32_t num_members, qp_stream_t *stream);
 uint32_t qp_stream_write_impl(const void *input_buf, uint32_t member_size, uint32_t num_members, qp_stream_t *stream);
 
+// Returns a pointer to up to `length` bytes from the current position, advancing past them and setting `count` to the
+// number of bytes available. Streams with direct access (i.e. memory streams) hand back a pointer into their own
+// buffer, anything else is read into `scratch`. Returns NULL if nothing could be read.
+const uint8_t *qp_stream_read_span(qp_stream_t *stream, uint8_t *scratch, uint32_t length, uint32_t *count);
+
 #define qp_stream_close(stream_ptr) (((qp_stream_t *)(stream_ptr))->close((qp_stream_t *)(stream_ptr)))
 
 #define STREAM_EOF ((int16_t)(-1))
@@ -55,6 +60,7 @@ typedef struct qp_stream_t {
     int32_t (*tell)(qp_stream_t *stream);
     bool (*is_eof)(qp_stream_t *stream);
     void (*close)(qp_stream_t *stream);
+    const uint8_t *(*read_direct)(qp_stream_t *stream, uint32_t length, uint32_t *count); // optional, zero-copy access
 } qp_stream_t;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
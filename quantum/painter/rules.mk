@@ -7,6 +7,7 @@ QUANTUM_PAINTER_LVGL_INTEGRATION ?= no
 # The list of permissible drivers that can be listed in QUANTUM_PAINTER_DRIVERS
 VALID_QUANTUM_PAINTER_DRIVERS := \
 	rgb565_surface \
+	palette_surface \
 	ili9163_spi \
 	ili9341_spi \
 	ili9488_spi \
@@ -44,6 +45,9 @@ endif
 # Comms flags
 QUANTUM_PAINTER_NEEDS_COMMS_SPI ?= no
 
+# Surface flags
+QUANTUM_PAINTER_NEEDS_SURFACE_DIRTY ?= no
+
 # Handler for each driver
 define handle_quantum_painter_driver
     CURRENT_PAINTER_DRIVER := $1
@@ -55,9 +59,18 @@ define handle_quantum_painter_driver
         OPT_DEFS += -DQUANTUM_PAINTER_RGB565_SURFACE_ENABLE
         COMMON_VPATH += \
             $(DRIVER_PATH)/painter/generic
+        QUANTUM_PAINTER_NEEDS_SURFACE_DIRTY := yes
         SRC += \
             $(DRIVER_PATH)/painter/generic/qp_rgb565_surface.c \
 
+    else ifeq ($$(strip $$(CURRENT_PAINTER_DRIVER)),palette_surface)
+        OPT_DEFS += -DQUANTUM_PAINTER_PALETTE_SURFACE_ENABLE
+        COMMON_VPATH += \
+            $(DRIVER_PATH)/painter/generic
+        QUANTUM_PAINTER_NEEDS_SURFACE_DIRTY := yes
+        SRC += \
+            $(DRIVER_PATH)/painter/generic/qp_palette_surface.c \
+
     else ifeq ($$(strip $$(CURRENT_PAINTER_DRIVER)),ili9163_spi)
         QUANTUM_PAINTER_NEEDS_COMMS_SPI := yes
         QUANTUM_PAINTER_NEEDS_COMMS_SPI_DC_RESET := yes
@@ -141,6 +154,11 @@ endef
 # Iterate through the listed drivers for the build, including what's necessary
 $(foreach qp_driver,$(QUANTUM_PAINTER_DRIVERS),$(eval $(call handle_quantum_painter_driver,$(qp_driver))))
 
+# If a surface is used, set up the shared dirty region tracking
+ifeq ($(strip $(QUANTUM_PAINTER_NEEDS_SURFACE_DIRTY)), yes)
+    SRC += $(DRIVER_PATH)/painter/generic/qp_surface_dirty.c
+endif
+
 # If SPI comms is needed, set up the required files
 ifeq ($(strip $(QUANTUM_PAINTER_NEEDS_COMMS_SPI)), yes)
     OPT_DEFS += -DQUANTUM_PAINTER_SPI_ENABLE
@@ -0,0 +1,74 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i anim-full.gif -f pal16 -d`
+
+#include <qp.h>
+
+const uint32_t gfx_anim_full_length = 976;
+
+// clang-format off
+const uint8_t gfx_anim_full[976] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0xD0, 0x03, 0x00, 0x00, 0x2F, 0xFC, 0xFF,
+    0xFF, 0x40, 0x00, 0x30, 0x00, 0x04, 0x00, 0x01, 0xFE, 0x10, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+    0x15, 0x01, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xE7, 0x02, 0x00, 0x00, 0x02, 0xFD, 0x06, 0x00,
+    0x00, 0x06, 0x00, 0x01, 0xFF, 0x64, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x2A, 0xB2, 0xC8, 0x5B,
+    0xDD, 0xE6, 0x9D, 0xC6, 0x5A, 0x00, 0xDD, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFA, 0xA4, 0x00,
+    0x00, 0x41, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03,
+    0x33, 0x1D, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03, 0x33, 0x7F, 0x22, 0x25, 0x22, 0x10, 0x00, 0x10,
+    0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10,
+    0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10,
+    0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10,
+    0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10,
+    0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10,
+    0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x63, 0x22, 0x02, 0x11, 0x1D,
+    0x22, 0x80, 0x12, 0x02, 0x11, 0x80, 0x21, 0x1C, 0x22, 0x04, 0x11, 0x1C, 0x22, 0x04, 0x11, 0x1C,
+    0x22, 0x04, 0x11, 0x1C, 0x22, 0x04, 0x11, 0x1C, 0x22, 0x80, 0x12, 0x02, 0x11, 0x80, 0x21, 0x1D,
+    0x22, 0x02, 0x11, 0x43, 0x22, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x00, 0x01, 0xFF, 0x64, 0x00,
+    0x03, 0xFC, 0x30, 0x00, 0x00, 0x2A, 0xB2, 0xC8, 0x5B, 0xDD, 0xE6, 0x9D, 0xC6, 0x5A, 0x00, 0xDD,
+    0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFA, 0xA4, 0x00, 0x00, 0x42, 0x22, 0x03, 0x33, 0x1D, 0x22,
+    0x03, 0x33, 0x1D, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03, 0x33, 0x1D, 0x22,
+    0x03, 0x33, 0x7F, 0x22, 0x24, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00,
+    0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00,
+    0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00,
+    0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00,
+    0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00,
+    0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00,
+    0x10, 0x22, 0x10, 0x00, 0x63, 0x22, 0x02, 0x11, 0x1D, 0x22, 0x80, 0x12, 0x02, 0x11, 0x80, 0x21,
+    0x1C, 0x22, 0x04, 0x11, 0x1C, 0x22, 0x04, 0x11, 0x1C, 0x22, 0x04, 0x11, 0x1C, 0x22, 0x04, 0x11,
+    0x1C, 0x22, 0x80, 0x12, 0x02, 0x11, 0x80, 0x21, 0x1D, 0x22, 0x02, 0x11, 0x43, 0x22, 0x02, 0xFD,
+    0x06, 0x00, 0x00, 0x06, 0x00, 0x01, 0xFF, 0x64, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x2A, 0xB2,
+    0xC8, 0x5B, 0xDD, 0xE6, 0x9D, 0xC6, 0x5A, 0x00, 0xDD, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFA,
+    0xA4, 0x00, 0x00, 0x43, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03, 0x33, 0x1D,
+    0x22, 0x03, 0x33, 0x1D, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03, 0x33, 0x7F, 0x22, 0x23, 0x22, 0x10,
+    0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10,
+    0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10,
+    0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10,
+    0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10,
+    0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10,
+    0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x63, 0x22, 0x02,
+    0x11, 0x1D, 0x22, 0x80, 0x12, 0x02, 0x11, 0x80, 0x21, 0x1C, 0x22, 0x04, 0x11, 0x1C, 0x22, 0x04,
+    0x11, 0x1C, 0x22, 0x04, 0x11, 0x1C, 0x22, 0x04, 0x11, 0x1C, 0x22, 0x80, 0x12, 0x02, 0x11, 0x80,
+    0x21, 0x1D, 0x22, 0x02, 0x11, 0x43, 0x22, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x00, 0x01, 0xFF,
+    0x64, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x2A, 0xB2, 0xC8, 0x5B, 0xDD, 0xE6, 0x9D, 0xC6, 0x5A,
+    0x00, 0xDD, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFA, 0xA4, 0x00, 0x00, 0x44, 0x22, 0x03, 0x33,
+    0x1D, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03, 0x33,
+    0x1D, 0x22, 0x03, 0x33, 0x7F, 0x22, 0x22, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22,
+    0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22,
+    0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22,
+    0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22,
+    0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22,
+    0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22,
+    0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x62, 0x22, 0x02, 0x11, 0x1D, 0x22, 0x80, 0x12, 0x02, 0x11,
+    0x80, 0x21, 0x1C, 0x22, 0x04, 0x11, 0x1C, 0x22, 0x04, 0x11, 0x1C, 0x22, 0x04, 0x11, 0x1C, 0x22,
+    0x04, 0x11, 0x1C, 0x22, 0x80, 0x12, 0x02, 0x11, 0x80, 0x21, 0x1D, 0x22, 0x02, 0x11, 0x44, 0x22,
+};
+// clang-format on
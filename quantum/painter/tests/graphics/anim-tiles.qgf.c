@@ -0,0 +1,55 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i anim-tiles.gif -f pal16`
+
+#include <qp.h>
+
+const uint32_t gfx_anim_tiles_length = 658;
+
+// clang-format off
+const uint8_t gfx_anim_tiles[658] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x92, 0x02, 0x00, 0x00, 0x6D, 0xFD, 0xFF,
+    0xFF, 0x40, 0x00, 0x30, 0x00, 0x04, 0x00, 0x01, 0xFE, 0x10, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+    0x15, 0x01, 0x00, 0x00, 0x7F, 0x01, 0x00, 0x00, 0xE9, 0x01, 0x00, 0x00, 0x02, 0xFD, 0x06, 0x00,
+    0x00, 0x06, 0x00, 0x01, 0xFF, 0x64, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x2A, 0xB2, 0xC8, 0x5B,
+    0xDD, 0xE6, 0x9D, 0xC6, 0x5A, 0x00, 0xDD, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFA, 0xA4, 0x00,
+    0x00, 0x41, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03,
+    0x33, 0x1D, 0x22, 0x03, 0x33, 0x1D, 0x22, 0x03, 0x33, 0x7F, 0x22, 0x25, 0x22, 0x10, 0x00, 0x10,
+    0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10,
+    0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10,
+    0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10,
+    0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10,
+    0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10,
+    0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x10, 0x22, 0x10, 0x00, 0x63, 0x22, 0x02, 0x11, 0x1D,
+    0x22, 0x80, 0x12, 0x02, 0x11, 0x80, 0x21, 0x1C, 0x22, 0x04, 0x11, 0x1C, 0x22, 0x04, 0x11, 0x1C,
+    0x22, 0x04, 0x11, 0x1C, 0x22, 0x04, 0x11, 0x1C, 0x22, 0x80, 0x12, 0x02, 0x11, 0x80, 0x21, 0x1D,
+    0x22, 0x02, 0x11, 0x43, 0x22, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x00, 0xFF, 0x64, 0x00,
+    0x03, 0xFC, 0x30, 0x00, 0x00, 0x00, 0xDD, 0xE6, 0x9D, 0xC6, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x09, 0x00,
+    0x07, 0x00, 0x05, 0xFA, 0x18, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02,
+    0xFD, 0x06, 0x00, 0x00, 0x06, 0x02, 0x00, 0xFF, 0x64, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x00,
+    0xDD, 0xE6, 0x9D, 0xC6, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFB, 0x08, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x0B, 0x00, 0x07, 0x00, 0x05, 0xFA, 0x18, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x06,
+    0x01, 0xFF, 0x64, 0x00, 0x03, 0xFC, 0x30, 0x00, 0x00, 0x2A, 0xB2, 0xC8, 0x5B, 0xDD, 0xE6, 0x9D,
+    0xC6, 0x5A, 0x00, 0xDD, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x06, 0x00,
+    0x02, 0x00, 0x3B, 0x00, 0x2D, 0x00, 0x06, 0xF9, 0x08, 0x00, 0x00, 0x08, 0x08, 0x01, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x05, 0xFA, 0x4A, 0x00, 0x00, 0x80, 0x22, 0x03, 0x33, 0x80, 0x22, 0x03, 0x33,
+    0x80, 0x22, 0x03, 0x33, 0x80, 0x22, 0x03, 0x33, 0x80, 0x22, 0x03, 0x33, 0x80, 0x22, 0x03, 0x33,
+    0x08, 0x22, 0x80, 0x00, 0x06, 0x22, 0x80, 0x00, 0x17, 0x22, 0x02, 0x11, 0x04, 0x22, 0x80, 0x12,
+    0x02, 0x11, 0x80, 0x21, 0x03, 0x22, 0x04, 0x11, 0x03, 0x22, 0x04, 0x11, 0x03, 0x22, 0x04, 0x11,
+    0x03, 0x22, 0x04, 0x11, 0x03, 0x22, 0x80, 0x12, 0x02, 0x11, 0x80, 0x21, 0x04, 0x22, 0x02, 0x11,
+    0x02, 0x22,
+};
+// clang-format on
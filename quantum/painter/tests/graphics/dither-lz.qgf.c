@@ -0,0 +1,52 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i dither-lz.png -f mono16`
+
+#include <qp.h>
+
+const uint32_t gfx_dither_lz_length = 620;
+
+// clang-format off
+const uint8_t gfx_dither_lz[620] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x6C, 0x02, 0x00, 0x00, 0x93, 0xFD, 0xFF,
+    0xFF, 0x60, 0x00, 0x40, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x02, 0x00, 0x02, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0x3C, 0x02, 0x00,
+    0x00, 0x00, 0x01, 0x11, 0x11, 0x12, 0x22, 0x22, 0x23, 0x00, 0x33, 0x33, 0x34, 0x34, 0xBB, 0xBB,
+    0xBA, 0xAA, 0x00, 0xAA, 0xA9, 0x99, 0x99, 0x98, 0x88, 0x88, 0x87, 0x00, 0x88, 0x88, 0x89, 0x89,
+    0x99, 0x99, 0x9A, 0xAA, 0x00, 0xAA, 0xAB, 0xBB, 0xBB, 0x43, 0x33, 0x33, 0x32, 0x00, 0x22, 0x22,
+    0x21, 0x21, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x10, 0x10, 0x11, 0x21, 0x21, 0x22, 0x22, 0x00,
+    0x32, 0x32, 0x33, 0x43, 0xBC, 0xBB, 0xAB, 0xAB, 0x40, 0xAA, 0x9A, 0x9A, 0x99, 0x89, 0x89, 0x30,
+    0x00, 0x87, 0x00, 0x88, 0x98, 0x98, 0x99, 0xA9, 0xA9, 0xAA, 0xBA, 0x00, 0xBA, 0xBB, 0x34, 0x34,
+    0x33, 0x33, 0x23, 0x23, 0xC0, 0x22, 0x12, 0x12, 0x11, 0x01, 0x01, 0x5F, 0x05, 0x60, 0x01, 0xFD,
+    0x5F, 0x09, 0x78, 0x60, 0x00, 0x5F, 0x09, 0x60, 0x01, 0x5F, 0x05, 0x60, 0x01, 0x5F, 0x09, 0xFB,
+    0x60, 0x01, 0x5F, 0x09, 0x44, 0x60, 0x00, 0x5F, 0x0D, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0x31, 0x00,
+    0xFF, 0xFE, 0xEE, 0xEE, 0xED, 0xDD, 0xDD, 0xDC, 0x00, 0xCC, 0xCC, 0xCB, 0xCB, 0x44, 0x44, 0x45,
+    0x55, 0x00, 0x55, 0x56, 0x66, 0x66, 0x67, 0x77, 0x77, 0x78, 0x00, 0x77, 0x77, 0x76, 0x76, 0x66,
+    0x66, 0x65, 0x55, 0x00, 0x55, 0x54, 0x44, 0x44, 0xBC, 0xCC, 0xCC, 0xCD, 0x00, 0xDD, 0xDD, 0xDE,
+    0xDE, 0xEE, 0xEE, 0xEF, 0xFF, 0x00, 0xFF, 0xEF, 0xEF, 0xEE, 0xDE, 0xDE, 0xDD, 0xDD, 0x00, 0xCD,
+    0xCD, 0xCC, 0xBC, 0x43, 0x44, 0x54, 0x54, 0x40, 0x55, 0x65, 0x65, 0x66, 0x76, 0x76, 0x30, 0x00,
+    0x78, 0x00, 0x77, 0x67, 0x67, 0x66, 0x56, 0x56, 0x55, 0x45, 0x00, 0x45, 0x44, 0xCB, 0xCB, 0xCC,
+    0xCC, 0xDC, 0xDC, 0xC0, 0xDD, 0xED, 0xED, 0xEE, 0xFE, 0xFE, 0x5F, 0x05, 0x60, 0x01, 0xFD, 0x5F,
+    0x09, 0x87, 0x60, 0x00, 0x5F, 0x09, 0x60, 0x01, 0x5F, 0x05, 0x60, 0x01, 0x5F, 0x09, 0xFB, 0x60,
+    0x01, 0x5F, 0x09, 0xBB, 0x60, 0x00, 0x5F, 0x0D, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0x31, 0x00, 0x00,
+    0x01, 0x11, 0x11, 0x12, 0x22, 0x22, 0x23, 0x00, 0x33, 0x33, 0x34, 0x34, 0xBB, 0xBB, 0xBA, 0xAA,
+    0x00, 0xAA, 0xA9, 0x99, 0x99, 0x98, 0x88, 0x88, 0x87, 0x00, 0x88, 0x88, 0x89, 0x89, 0x99, 0x99,
+    0x9A, 0xAA, 0x00, 0xAA, 0xAB, 0xBB, 0xBB, 0x43, 0x33, 0x33, 0x32, 0x00, 0x22, 0x22, 0x21, 0x21,
+    0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x10, 0x10, 0x11, 0x21, 0x21, 0x22, 0x22, 0x00, 0x32, 0x32,
+    0x33, 0x43, 0xBC, 0xBB, 0xAB, 0xAB, 0x40, 0xAA, 0x9A, 0x9A, 0x99, 0x89, 0x89, 0x30, 0x00, 0x87,
+    0x00, 0x88, 0x98, 0x98, 0x99, 0xA9, 0xA9, 0xAA, 0xBA, 0x00, 0xBA, 0xBB, 0x34, 0x34, 0x33, 0x33,
+    0x23, 0x23, 0xC0, 0x22, 0x12, 0x12, 0x11, 0x01, 0x01, 0x5F, 0x05, 0x60, 0x01, 0xFD, 0x5F, 0x09,
+    0x78, 0x60, 0x00, 0x5F, 0x09, 0x60, 0x01, 0x5F, 0x05, 0x60, 0x01, 0x5F, 0x09, 0xFB, 0x60, 0x01,
+    0x5F, 0x09, 0x44, 0x60, 0x00, 0x5F, 0x0D, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0x31, 0x00, 0xFF, 0xFE,
+    0xEE, 0xEE, 0xED, 0xDD, 0xDD, 0xDC, 0x00, 0xCC, 0xCC, 0xCB, 0xCB, 0x44, 0x44, 0x45, 0x55, 0x00,
+    0x55, 0x56, 0x66, 0x66, 0x67, 0x77, 0x77, 0x78, 0x00, 0x77, 0x77, 0x76, 0x76, 0x66, 0x66, 0x65,
+    0x55, 0x00, 0x55, 0x54, 0x44, 0x44, 0xBC, 0xCC, 0xCC, 0xCD, 0x00, 0xDD, 0xDD, 0xDE, 0xDE, 0xEE,
+    0xEE, 0xEF, 0xFF, 0x00, 0xFF, 0xEF, 0xEF, 0xEE, 0xDE, 0xDE, 0xDD, 0xDD, 0x00, 0xCD, 0xCD, 0xCC,
+    0xBC, 0x43, 0x44, 0x54, 0x54, 0x40, 0x55, 0x65, 0x65, 0x66, 0x76, 0x76, 0x30, 0x00, 0x78, 0x00,
+    0x77, 0x67, 0x67, 0x66, 0x56, 0x56, 0x55, 0x45, 0x00, 0x45, 0x44, 0xCB, 0xCB, 0xCC, 0xCC, 0xDC,
+    0xDC, 0xC0, 0xDD, 0xED, 0xED, 0xEE, 0xFE, 0xFE, 0x5F, 0x05, 0x60, 0x01, 0xFD, 0x5F, 0x09, 0x87,
+    0x60, 0x00, 0x5F, 0x09, 0x60, 0x01, 0x5F, 0x05, 0x60, 0x01, 0x5F, 0x09, 0xFB, 0x60, 0x01, 0x5F,
+    0x09, 0xBB, 0x60, 0x00, 0x5F, 0x0D, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0x31,
+};
+// clang-format on
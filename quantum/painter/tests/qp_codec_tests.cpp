@@ -0,0 +1,537 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <vector>
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_draw.h"
+#include "qp_stream.h"
+#include "qgf.h"
+#include "qp_rgb565_surface.h"
+#include "djinn.qgf.h"
+#include "lock-caps-ON.qgf.h"
+#include "lock-num-OFF.qgf.h"
+#include "thintel15.qff.h"
+#include "graphics/dither-lz.qgf.h"
+#include "graphics/dither-raw.qgf.h"
+}
+
+#define SURFACE_WIDTH 240
+#define SURFACE_HEIGHT 320
+
+static uint16_t         framebuffer[SURFACE_WIDTH * SURFACE_HEIGHT];
+static uint16_t         reference[SURFACE_WIDTH * SURFACE_HEIGHT];
+static painter_device_t surface;
+
+static const qp_pixel_t white = {.hsv888 = {.h = 0, .s = 0, .v = 255}};
+static const qp_pixel_t black = {.hsv888 = {.h = 0, .s = 0, .v = 0}};
+
+struct asset {
+    const char *   name;
+    const uint8_t *data;
+    uint32_t       length;
+};
+
+static const asset images[] = {
+    {"djinn", gfx_djinn, sizeof(gfx_djinn)},
+    {"lock-caps-ON", gfx_lock_caps_ON, sizeof(gfx_lock_caps_ON)},
+    {"lock-num-OFF", gfx_lock_num_OFF, sizeof(gfx_lock_num_OFF)},
+};
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static uint32_t fnv1a(const void *data, size_t size) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint32_t       hash  = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Converts a grayscale ramp for the given bpp into the surface's native format
+static void prepare_palette(uint8_t bpp) {
+    painter_driver_t *driver = (painter_driver_t *)surface;
+    qp_internal_invalidate_palette();
+    qp_internal_interpolate_palette(white, black, 1 << bpp);
+    driver->driver_vtable->palette_convert(surface, 1 << bpp, qp_internal_global_pixel_lookup_table);
+}
+
+// Streams pixel_count indices through the original per-pixel path: one byte callback per input
+// byte and one append_pixels call per pixel.
+static bool decode_per_pixel(qp_stream_t *stream, painter_compression_t compression, uint32_t pixel_count, uint8_t bpp) {
+    qp_internal_byte_input_state_t   input_state    = {.device = surface, .src_stream = stream};
+    qp_internal_byte_input_callback  input_callback = qp_internal_prepare_input_state(&input_state, compression);
+    qp_internal_pixel_output_state_t output_state   = {.device = surface, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(surface)};
+
+    painter_driver_t *driver = (painter_driver_t *)surface;
+    bool              ret    = qp_internal_decode_palette(surface, pixel_count, bpp, input_callback, &input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
+    if (ret && output_state.pixel_write_pos > 0) {
+        ret &= driver->driver_vtable->pixdata(surface, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+    }
+    return ret;
+}
+
+// Streams pixel_count indices through the span decoder
+static bool decode_spans(qp_stream_t *stream, painter_compression_t compression, uint32_t pixel_count, uint8_t bpp) {
+    qp_internal_byte_input_state_t   input_state  = {.device = surface, .src_stream = stream};
+    qp_internal_pixel_output_state_t output_state = {.device = surface, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(surface)};
+    if (!qp_internal_prepare_input_state(&input_state, compression)) {
+        return false;
+    }
+
+    painter_driver_t *driver = (painter_driver_t *)surface;
+    bool              ret    = qp_internal_decode_palette_spans(surface, pixel_count, bpp, &input_state, qp_internal_global_pixel_lookup_table, &output_state);
+    if (ret && output_state.pixel_write_pos > 0) {
+        ret &= driver->driver_vtable->pixdata(surface, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+    }
+    return ret;
+}
+
+enum decode_mode {
+    DECODE_PER_PIXEL,      // original byte callback + single pixel appends
+    DECODE_SPANS_STREAMED, // span decoder reading through the stream's get() like a file stream would
+    DECODE_SPANS_DIRECT,   // span decoder reading memory-backed data in place
+};
+
+static qp_memory_stream_t make_stream(const void *data, uint32_t length, decode_mode mode) {
+    qp_memory_stream_t stream = qp_make_memory_stream((void *)data, length);
+    if (mode != DECODE_SPANS_DIRECT) {
+        stream.base.read_direct = NULL;
+    }
+    return stream;
+}
+
+static bool decode(decode_mode mode, qp_stream_t *stream, painter_compression_t compression, uint32_t pixel_count, uint8_t bpp) {
+    return mode == DECODE_PER_PIXEL ? decode_per_pixel(stream, compression, pixel_count, bpp) : decode_spans(stream, compression, pixel_count, bpp);
+}
+
+// Same format as compress_bytes_qmk_rle() in lib/python/qmk/painter.py, though not necessarily the same choice of runs
+static std::vector<uint8_t> rle_encode(const std::vector<uint8_t> &input) {
+    std::vector<uint8_t> output;
+    size_t               i = 0;
+    while (i < input.size()) {
+        size_t run = 1;
+        while (i + run < input.size() && run < 127 && input[i + run] == input[i]) {
+            run++;
+        }
+        if (run >= 2) {
+            output.push_back(run);
+            output.push_back(input[i]);
+            i += run;
+            continue;
+        }
+
+        size_t literal = 1;
+        while (i + literal < input.size() && literal < 128 && !(i + literal + 1 < input.size() && input[i + literal] == input[i + literal + 1])) {
+            literal++;
+        }
+        output.push_back(127 + literal);
+        output.insert(output.end(), input.begin() + i, input.begin() + i + literal);
+        i += literal;
+    }
+    return output;
+}
+
+// Same format as compress_bytes_qmk_lz() in lib/python/qmk/painter.py, though not necessarily the same choice of matches
+static std::vector<uint8_t> lz_encode(const std::vector<uint8_t> &input) {
+    const size_t         max_match = QP_LZ_MIN_MATCH + 255;
+    std::vector<uint8_t> output;
+    size_t               flags_pos = 0;
+    int                  items     = 8;
+    size_t               i         = 0;
+    while (i < input.size()) {
+        if (items == 8) {
+            flags_pos = output.size();
+            output.push_back(0);
+            items = 0;
+        }
+
+        size_t best_length = 0, best_distance = 0;
+        for (size_t distance = 1; distance <= QP_LZ_WINDOW_SIZE && distance <= i; distance++) {
+            size_t length = 0;
+            while (length < max_match && i + length < input.size() && input[i + length - distance] == input[i + length]) {
+                length++;
+            }
+            if (length > best_length) {
+                best_length   = length;
+                best_distance = distance;
+            }
+        }
+
+        if (best_length >= QP_LZ_MIN_MATCH) {
+            output[flags_pos] |= 1 << items;
+            output.push_back(best_distance - 1);
+            output.push_back(best_length - QP_LZ_MIN_MATCH);
+            i += best_length;
+        } else {
+            output.push_back(input[i++]);
+        }
+        items++;
+    }
+    return output;
+}
+
+// Packed pixel data as dithered artwork comes out -- short alternating patterns which RLE can't do much with
+static std::vector<uint8_t> make_dithered_bytes(size_t length, uint32_t seed) {
+    std::vector<uint8_t> output;
+    while (output.size() < length) {
+        seed           = seed * 1103515245u + 12345u;
+        size_t  run    = (seed >> 8) % 700 + 1;
+        uint8_t a      = (seed >> 20) & 0x0F;
+        uint8_t b      = (seed >> 24) & 0x0F;
+        uint8_t period = 2 + ((seed >> 28) & 3);
+        for (size_t i = 0; i < run && output.size() < length; i++) {
+            output.push_back((i % period) ? a : b);
+        }
+    }
+    return output;
+}
+
+// Packed pixel data with a mix of long runs and noise, restricted to the first 16 palette entries
+static std::vector<uint8_t> make_pixel_bytes(size_t length, uint32_t seed) {
+    std::vector<uint8_t> output;
+    while (output.size() < length) {
+        seed         = seed * 1103515245u + 12345u;
+        size_t  run  = (seed >> 8) % 300 + 1;
+        uint8_t byte = (seed >> 20) & 0x0F;
+        for (size_t i = 0; i < run && output.size() < length; i++) {
+            output.push_back((seed & 0x80000000u) ? byte : (uint8_t)((byte + i * 7) & 0x0F));
+        }
+    }
+    return output;
+}
+
+// Draws frame 0 of a QGF image at the origin, bypassing the image handles so the decoder can be picked
+static bool draw_image(const asset &image, decode_mode mode) {
+    qp_memory_stream_t stream = make_stream(image.data, image.length, mode);
+
+    uint16_t width, height, frame_count;
+    if (!qgf_read_graphics_descriptor(&stream.base, &width, &height, &frame_count, NULL)) {
+        return false;
+    }
+
+    qgf_seek_to_frame_descriptor(&stream.base, 0);
+    qgf_frame_v1_t frame;
+    if (qp_stream_read(&frame, sizeof(frame), 1, &stream) != 1) {
+        return false;
+    }
+
+    uint8_t               bpp;
+    bool                  has_palette, is_delta;
+    painter_compression_t compression;
+    uint16_t              delay;
+    if (!qgf_parse_frame_descriptor(&frame, &bpp, &has_palette, &is_delta, &compression, &delay) || has_palette || is_delta) {
+        return false;
+    }
+
+    qgf_data_v1_t data;
+    if (qp_stream_read(&data, sizeof(data), 1, &stream) != 1) {
+        return false;
+    }
+
+    prepare_palette(bpp);
+    painter_driver_t *driver = (painter_driver_t *)surface;
+    driver->driver_vtable->viewport(surface, 0, 0, width - 1, height - 1);
+    return decode(mode, &stream.base, compression, (uint32_t)width * height, bpp);
+}
+
+class QuantumPainterCodec : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        // Surfaces come from a fixed pool, so create the one we need once
+        surface = qp_rgb565_make_surface(SURFACE_WIDTH, SURFACE_HEIGHT, framebuffer);
+    }
+
+    void SetUp() override {
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        memset(framebuffer, 0, sizeof(framebuffer));
+        qp_internal_invalidate_palette();
+    }
+};
+
+TEST_F(QuantumPainterCodec, ImagesMatchGolden) {
+    // FNV-1a of the framebuffer after drawing each image, captured from the per-pixel decoder
+    const uint32_t expected[] = {2163658945u, 3687196651u, 3854745675u};
+    for (size_t i = 0; i < sizeof(images) / sizeof(images[0]); i++) {
+        memset(framebuffer, 0, sizeof(framebuffer));
+        painter_image_handle_t image = qp_load_image_mem(images[i].data);
+        ASSERT_NE(image, nullptr) << images[i].name;
+        EXPECT_TRUE(qp_drawimage(surface, 0, 0, image)) << images[i].name;
+        EXPECT_EQ(fnv1a(framebuffer, sizeof(framebuffer)), expected[i]) << images[i].name;
+        qp_close_image(image);
+    }
+}
+
+TEST_F(QuantumPainterCodec, TextMatchesGolden) {
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr);
+    EXPECT_GT(qp_drawtext(surface, 0, 0, font, "Quantum Painter 0123456789"), 0);
+    EXPECT_GT(qp_drawtext_recolor(surface, 3, 20, font, "caps num scrl", 0, 255, 255, 170, 255, 64), 0);
+    EXPECT_EQ(fnv1a(framebuffer, sizeof(framebuffer)), 424808307u);
+    qp_close_font(font);
+}
+
+TEST_F(QuantumPainterCodec, TextRedrawMatches) {
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr);
+    EXPECT_EQ(qp_textwidth(font, "Quantum Painter 0123456789"), 116);
+
+    // Second pass is served from the glyph cache, if enabled
+    for (int pass = 0; pass < 2; pass++) {
+        memset(framebuffer, 0, sizeof(framebuffer));
+        EXPECT_GT(qp_drawtext(surface, 0, 0, font, "Quantum Painter 0123456789"), 0);
+        EXPECT_GT(qp_drawtext_recolor(surface, 3, 20, font, "caps num scrl", 0, 255, 255, 170, 255, 64), 0);
+        EXPECT_EQ(fnv1a(framebuffer, sizeof(framebuffer)), 424808307u) << "pass " << pass;
+    }
+
+    // Same glyphs in different colors must not come out of the cache
+    memset(framebuffer, 0, sizeof(framebuffer));
+    EXPECT_GT(qp_drawtext_recolor(surface, 0, 0, font, "Quantum Painter 0123456789", 0, 0, 255, 0, 0, 0), 0);
+    EXPECT_GT(qp_drawtext_recolor(surface, 3, 20, font, "caps num scrl", 85, 255, 255, 170, 255, 64), 0);
+    EXPECT_NE(fnv1a(framebuffer, sizeof(framebuffer)), 424808307u);
+
+    // Nor after the font is reloaded
+    qp_close_font(font);
+    font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr);
+    memset(framebuffer, 0, sizeof(framebuffer));
+    EXPECT_GT(qp_drawtext(surface, 0, 0, font, "Quantum Painter 0123456789"), 0);
+    EXPECT_GT(qp_drawtext_recolor(surface, 3, 20, font, "caps num scrl", 0, 255, 255, 170, 255, 64), 0);
+    EXPECT_EQ(fnv1a(framebuffer, sizeof(framebuffer)), 424808307u);
+    qp_close_font(font);
+}
+
+TEST_F(QuantumPainterCodec, ImagesMatchPerPixelDecoder) {
+    for (const asset &entry : images) {
+        memset(reference, 0, sizeof(reference));
+        memset(framebuffer, 0, sizeof(framebuffer));
+        ASSERT_TRUE(draw_image(entry, DECODE_PER_PIXEL)) << entry.name;
+        memcpy(reference, framebuffer, sizeof(reference));
+
+        memset(framebuffer, 0, sizeof(framebuffer));
+        painter_image_handle_t image = qp_load_image_mem(entry.data);
+        ASSERT_NE(image, nullptr) << entry.name;
+        EXPECT_TRUE(qp_drawimage(surface, 0, 0, image)) << entry.name;
+        EXPECT_EQ(memcmp(framebuffer, reference, sizeof(reference)), 0) << entry.name;
+        qp_close_image(image);
+    }
+}
+
+TEST_F(QuantumPainterCodec, SpansMatchPerPixelDecoder) {
+    painter_driver_t *driver = (painter_driver_t *)surface;
+    for (uint8_t bpp : {1, 2, 4, 8}) {
+        // Only 16 palette entries are available, the 8bpp data is restricted to match
+        prepare_palette(bpp > 4 ? 4 : bpp);
+        for (painter_compression_t compression : {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE, IMAGE_COMPRESSED_LZ}) {
+            for (uint32_t pixel_count : {1u, 7u, 63u, 65u, 513u, 1500u, 9999u}) {
+                std::vector<uint8_t> data = make_pixel_bytes((pixel_count * bpp + 7) / 8, pixel_count * bpp);
+                if (compression == IMAGE_COMPRESSED_RLE) {
+                    data = rle_encode(data);
+                } else if (compression == IMAGE_COMPRESSED_LZ) {
+                    data = lz_encode(data);
+                }
+
+                for (decode_mode mode : {DECODE_PER_PIXEL, DECODE_SPANS_STREAMED, DECODE_SPANS_DIRECT}) {
+                    memset(framebuffer, 0, sizeof(framebuffer));
+                    qp_memory_stream_t stream = make_stream(data.data(), data.size(), mode);
+                    driver->driver_vtable->viewport(surface, 0, 0, SURFACE_WIDTH - 1, SURFACE_HEIGHT - 1);
+                    ASSERT_TRUE(decode(mode, &stream.base, compression, pixel_count, bpp));
+                    if (mode == DECODE_PER_PIXEL) {
+                        memcpy(reference, framebuffer, sizeof(reference));
+                        continue;
+                    }
+
+                    EXPECT_EQ(memcmp(framebuffer, reference, sizeof(reference)), 0) << "bpp " << (int)bpp << ", compression " << compression << ", pixels " << pixel_count << ", mode " << mode;
+                    EXPECT_EQ(stream.position, (int32_t)data.size()) << "bpp " << (int)bpp << ", compression " << compression << ", pixels " << pixel_count << ", mode " << mode;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(QuantumPainterCodec, LzRoundTrip) {
+    std::vector<std::vector<uint8_t>> inputs = {
+        {0x42},
+        std::vector<uint8_t>(1000, 0x11),  // matches overlapping the bytes they write, up to the maximum length
+        make_pixel_bytes(5000, 1),         // runs and noise
+        make_dithered_bytes(5000, 2),      // short repeating patterns
+        make_dithered_bytes(QP_LZ_WINDOW_SIZE * 3 + 1, 3),
+    };
+    for (size_t n = 0; n < 2000; n++) {
+        inputs.back().push_back(n * 2654435761u >> 24); // matches right at the edge of the window
+    }
+
+    for (size_t i = 0; i < inputs.size(); i++) {
+        const std::vector<uint8_t> &input = inputs[i];
+        std::vector<uint8_t>        data  = lz_encode(input);
+
+        // Byte at a time
+        qp_memory_stream_t              stream         = make_stream(data.data(), data.size(), DECODE_SPANS_STREAMED);
+        qp_internal_byte_input_state_t  input_state    = {.device = surface, .src_stream = &stream.base};
+        qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, IMAGE_COMPRESSED_LZ);
+        ASSERT_NE(input_callback, nullptr);
+        std::vector<uint8_t> output;
+        for (size_t n = 0; n < input.size(); n++) {
+            int16_t c = input_callback(&input_state);
+            ASSERT_GE(c, 0) << "input " << i << ", byte " << n;
+            output.push_back(c);
+        }
+        EXPECT_EQ(output, input) << "input " << i;
+        EXPECT_EQ(stream.position, (int32_t)data.size()) << "input " << i;
+        EXPECT_LT(input_callback(&input_state), 0) << "input " << i;
+
+        // In spans, which may end part way through a match
+        for (decode_mode mode : {DECODE_SPANS_STREAMED, DECODE_SPANS_DIRECT}) {
+            stream = make_stream(data.data(), data.size(), mode);
+            qp_internal_prepare_input_state(&input_state, IMAGE_COMPRESSED_LZ);
+            output.clear();
+            uint8_t  scratch[37];
+            uint16_t count;
+            while (output.size() < input.size()) {
+                const uint8_t *span = qp_internal_read_span(&input_state, scratch, QP_MIN(sizeof(scratch), input.size() - output.size()), &count);
+                ASSERT_NE(span, nullptr) << "input " << i << ", mode " << mode;
+                output.insert(output.end(), span, span + count);
+            }
+            EXPECT_EQ(output, input) << "input " << i << ", mode " << mode;
+            EXPECT_EQ(stream.position, (int32_t)data.size()) << "input " << i << ", mode " << mode;
+            EXPECT_EQ(qp_internal_read_span(&input_state, scratch, sizeof(scratch), &count), nullptr) << "input " << i << ", mode " << mode;
+        }
+    }
+}
+
+TEST_F(QuantumPainterCodec, LzImageMatchesUncompressed) {
+    // Both generated from the same dithered image by painter-convert-graphics, with and without compression
+    qp_memory_stream_t stream = make_stream(gfx_dither_lz, sizeof(gfx_dither_lz), DECODE_SPANS_DIRECT);
+    qgf_seek_to_frame_descriptor(&stream.base, 0);
+    qgf_frame_v1_t frame;
+    ASSERT_EQ(qp_stream_read(&frame, sizeof(frame), 1, &stream), 1);
+    EXPECT_EQ(frame.compression_scheme, IMAGE_COMPRESSED_LZ);
+    EXPECT_LT(sizeof(gfx_dither_lz) * 4, sizeof(gfx_dither_raw));
+
+    const asset lz  = {"dither-lz", gfx_dither_lz, sizeof(gfx_dither_lz)};
+    const asset raw = {"dither-raw", gfx_dither_raw, sizeof(gfx_dither_raw)};
+    ASSERT_TRUE(draw_image(raw, DECODE_PER_PIXEL));
+    memcpy(reference, framebuffer, sizeof(reference));
+    for (decode_mode mode : {DECODE_PER_PIXEL, DECODE_SPANS_STREAMED, DECODE_SPANS_DIRECT}) {
+        memset(framebuffer, 0, sizeof(framebuffer));
+        ASSERT_TRUE(draw_image(lz, mode)) << "mode " << mode;
+        EXPECT_EQ(memcmp(framebuffer, reference, sizeof(reference)), 0) << "mode " << mode;
+    }
+
+    memset(framebuffer, 0, sizeof(framebuffer));
+    painter_image_handle_t image = qp_load_image_mem(gfx_dither_lz);
+    ASSERT_NE(image, nullptr);
+    EXPECT_TRUE(qp_drawimage(surface, 0, 0, image));
+    EXPECT_EQ(memcmp(framebuffer, reference, sizeof(reference)), 0);
+    qp_close_image(image);
+}
+
+TEST_F(QuantumPainterCodec, ReadSpanStopsAtEndOfStream) {
+    uint8_t data[] = {1, 2, 3, 4, 5};
+    uint8_t scratch[8];
+    for (decode_mode mode : {DECODE_SPANS_STREAMED, DECODE_SPANS_DIRECT}) {
+        qp_memory_stream_t stream = make_stream(data, sizeof(data), mode);
+        uint32_t           count  = 0;
+
+        const uint8_t *span = qp_stream_read_span(&stream.base, scratch, 3, &count);
+        ASSERT_NE(span, nullptr);
+        EXPECT_EQ(count, 3u);
+        EXPECT_EQ(memcmp(span, data, 3), 0);
+        EXPECT_EQ(span == scratch, mode == DECODE_SPANS_STREAMED);
+        EXPECT_FALSE(qp_stream_eof(&stream));
+
+        span = qp_stream_read_span(&stream.base, scratch, 8, &count);
+        ASSERT_NE(span, nullptr);
+        EXPECT_EQ(count, 2u);
+        EXPECT_EQ(memcmp(span, &data[3], 2), 0);
+        EXPECT_TRUE(qp_stream_eof(&stream));
+
+        EXPECT_EQ(qp_stream_read_span(&stream.base, scratch, 8, &count), nullptr);
+    }
+}
+
+TEST_F(QuantumPainterCodec, Benchmark) {
+    const char *names[] = {"per-pixel", "span", "span+direct"};
+    printf("%-14s %9s %14s %14s %14s\n", "image", "pixels", "per-pixel px/s", "span px/s", "direct px/s");
+    for (const asset &entry : images) {
+        painter_image_handle_t image = qp_load_image_mem(entry.data);
+        ASSERT_NE(image, nullptr) << entry.name;
+        uint32_t pixels = (uint32_t)image->width * image->height;
+        uint32_t rounds = 1 + 2000000 / pixels;
+        qp_close_image(image);
+
+        printf("%-14s %9u", entry.name, pixels);
+        for (decode_mode mode : {DECODE_PER_PIXEL, DECODE_SPANS_STREAMED, DECODE_SPANS_DIRECT}) {
+            uint64_t start = now_ns();
+            for (uint32_t i = 0; i < rounds; i++) {
+                ASSERT_TRUE(draw_image(entry, mode)) << names[mode];
+            }
+            printf(" %14.0f", (double)pixels * rounds * 1e9 / (now_ns() - start));
+        }
+        printf("\n");
+    }
+}
+
+TEST_F(QuantumPainterCodec, CompressionBenchmark) {
+    const char *names[]  = {"none", "rle", "lz"};
+    const int   rounds   = 50;
+    uint8_t     scratch[QUANTUM_PAINTER_DECODE_SPAN_SIZE];
+    printf("%-10s %-6s %9s %9s %14s\n", "data", "codec", "bytes", "encoded", "decode B/s");
+    for (int kind = 0; kind < 2; kind++) {
+        std::vector<uint8_t> input = kind ? make_dithered_bytes(64000, 4) : make_pixel_bytes(64000, 4);
+        for (painter_compression_t compression : {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE, IMAGE_COMPRESSED_LZ}) {
+            std::vector<uint8_t> data = compression == IMAGE_COMPRESSED_RLE ? rle_encode(input) : compression == IMAGE_COMPRESSED_LZ ? lz_encode(input) : input;
+
+            uint64_t start = now_ns();
+            for (int i = 0; i < rounds; i++) {
+                qp_memory_stream_t             stream      = make_stream(data.data(), data.size(), DECODE_SPANS_DIRECT);
+                qp_internal_byte_input_state_t input_state = {.device = surface, .src_stream = &stream.base};
+                qp_internal_prepare_input_state(&input_state, compression);
+                size_t   remaining = input.size();
+                uint16_t count;
+                while (remaining > 0) {
+                    ASSERT_NE(qp_internal_read_span(&input_state, scratch, QP_MIN(sizeof(scratch), remaining), &count), nullptr) << names[compression];
+                    remaining -= count;
+                }
+            }
+            printf("%-10s %-6s %9zu %9zu %14.0f\n", kind ? "dithered" : "runs", names[compression], input.size(), data.size(), (double)input.size() * rounds * 1e9 / (now_ns() - start));
+        }
+    }
+}
+
+TEST_F(QuantumPainterCodec, TextBenchmark) {
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr);
+    const char *text   = "WPM: 123  Layer: QWERTY";
+    const int   rounds = 20000;
+
+    uint64_t start = now_ns();
+    int16_t  width = 0;
+    for (int i = 0; i < rounds; i++) {
+        width = qp_drawtext(surface, 0, 0, font, text);
+        ASSERT_GT(width, 0);
+    }
+    uint64_t draw_ns = now_ns() - start;
+
+    start = now_ns();
+    for (int i = 0; i < rounds; i++) {
+        ASSERT_EQ(qp_textwidth(font, text), width);
+    }
+    uint64_t width_ns = now_ns() - start;
+
+    printf("glyph cache entries: %d\n", QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES);
+    printf("qp_drawtext:  %8.0f strings/s %12.0f px/s\n", rounds * 1e9 / draw_ns, (double)width * font->line_height * rounds * 1e9 / draw_ns);
+    printf("qp_textwidth: %8.0f strings/s\n", rounds * 1e9 / width_ns);
+    qp_close_font(font);
+}
@@ -0,0 +1,247 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+extern "C" {
+#include "qp.h"
+#include "painter_bench.h"
+#include "djinn.qgf.h"
+#include "lock-caps-ON.qgf.h"
+#include "lock-num-OFF.qgf.h"
+#include "thintel15.qff.h"
+#include "graphics/anim-tiles.qgf.h"
+#include "graphics/anim-full.qgf.h"
+
+void advance_time(uint32_t ms);
+void qp_internal_animation_tick(void);
+}
+
+#define WIDTH 240
+#define HEIGHT 320
+#define BENCH_ITERATIONS 200
+#define LINK_NS_PER_BYTE 4
+#define LINK_ITERATIONS 20
+
+static void render_pixels(painter_device_t device, uint32_t iteration) {
+    for (uint16_t i = 0; i < 256; i++) {
+        qp_setpixel(device, (i * 37 + iteration) % WIDTH, (i * 91) % HEIGHT, i, 255, 255);
+    }
+}
+
+static void render_lines(painter_device_t device, uint32_t iteration) {
+    for (uint16_t i = 0; i < 16; i++) {
+        uint8_t hue = i * 16 + iteration;
+        qp_line(device, 0, i * 20, WIDTH - 1, i * 20, hue, 255, 255);
+        qp_line(device, i * 15, 0, i * 15, HEIGHT - 1, hue, 255, 255);
+        qp_line(device, WIDTH / 2, HEIGHT / 2, i * 15, (i & 1) ? 0 : HEIGHT - 1, hue, 255, 255);
+    }
+}
+
+static void render_rects(painter_device_t device, uint32_t iteration) {
+    for (uint16_t i = 0; i < 12; i++) {
+        qp_rect(device, i * 10, i * 13, WIDTH - 1 - i * 10, HEIGHT - 1 - i * 13, i * 21 + iteration, 255, 255, i & 1);
+    }
+}
+
+static void render_circles(painter_device_t device, uint32_t iteration) {
+    for (uint16_t r = 0; r < 40; r++) {
+        qp_circle(device, 20 + (r % 5) * 50, 20 + (r / 5) * 38, r / 2, r * 6 + iteration, 255, 255, r & 1);
+    }
+    qp_circle(device, WIDTH / 2, HEIGHT / 2, 100, 200, 255, 255, false);
+}
+
+static void render_ellipses(painter_device_t device, uint32_t iteration) {
+    for (uint16_t i = 0; i < 40; i++) {
+        qp_ellipse(device, 24 + (i % 5) * 48, 20 + (i / 5) * 38, 1 + (i * 7) % 23, 1 + (i * 5) % 17, i * 6 + iteration, 255, 255, i & 1);
+    }
+    qp_ellipse(device, WIDTH / 2, HEIGHT / 2, 110, 60, 200, 255, 255, false);
+}
+
+static void render_images(painter_device_t device, uint32_t iteration) {
+    painter_image_handle_t djinn = qp_load_image_mem(gfx_djinn);
+    painter_image_handle_t caps  = qp_load_image_mem(gfx_lock_caps_ON);
+    painter_image_handle_t num   = qp_load_image_mem(gfx_lock_num_OFF);
+    qp_drawimage(device, 0, 0, djinn);
+    qp_drawimage(device, 10, 250, caps);
+    qp_drawimage_recolor(device, 60, 250, num, iteration, 255, 255, 0, 0, 0);
+    qp_close_image(num);
+    qp_close_image(caps);
+    qp_close_image(djinn);
+}
+
+static void render_text(painter_device_t device, uint32_t iteration) {
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15);
+    for (uint16_t line = 0; line < 18; line++) {
+        qp_drawtext_recolor(device, 2, line * font->line_height, font, "The quick brown fox jumps", line * 14 + iteration, 255, 255, 0, 0, 0);
+    }
+    qp_close_font(font);
+}
+
+struct scene {
+    const char *name;
+    void (*render)(painter_device_t device, uint32_t iteration);
+    uint32_t golden;
+};
+
+static const scene scenes[] = {
+    {"pixels", render_pixels, 0x1023a7e7},
+    {"lines", render_lines, 0x4bb4e019},
+    {"rects", render_rects, 0xd69a4d65},
+    {"circles", render_circles, 0x087fbf8a},
+    {"ellipses", render_ellipses, 0x91466e60},
+    {"images", render_images, 0xfeec84fd},
+    {"text", render_text, 0xa45f89ad},
+};
+
+class QuantumPainterDraw : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        device = painter_bench_device(WIDTH, HEIGHT);
+        ASSERT_NE(device, nullptr);
+    }
+
+    painter_device_t device;
+};
+
+TEST_F(QuantumPainterDraw, ScenesMatchGolden) {
+    for (auto &s : scenes) {
+        device = painter_bench_device(WIDTH, HEIGHT);
+        s.render(device, 0);
+        EXPECT_TRUE(painter_bench_matches_golden(s.name, s.golden)) << s.name;
+    }
+}
+
+TEST_F(QuantumPainterDraw, PixelStreamsAreRecorded) {
+    painter_bench_result_t result;
+    painter_bench_run(render_rects, 1, &result);
+    EXPECT_EQ(1u, result.iterations);
+    EXPECT_GT(result.pixels, 0u);
+
+    // Filled rects are a single viewport, outlines are one per edge
+    EXPECT_EQ(6u + 6u * 4, result.viewports);
+}
+
+static void render_filled_shapes(painter_device_t device, uint32_t iteration) {
+    qp_circle(device, 60, 60, 40, iteration, 255, 255, true);
+    qp_ellipse(device, 120, 200, 100, 30, iteration, 255, 255, true);
+}
+
+TEST_F(QuantumPainterDraw, FilledShapesAreOneViewportPerScanline) {
+    painter_bench_result_t result;
+    painter_bench_run(render_filled_shapes, 1, &result);
+    EXPECT_EQ((2u * 40 + 1) + (2u * 30 + 1), result.viewports);
+}
+
+static painter_image_handle_t animation;
+static deferred_token         animation_token;
+
+static void render_animation(painter_device_t device, uint32_t iteration) {
+    if (iteration == 0) {
+        animation_token = qp_animate(device, 10, 10, animation);
+    } else {
+        advance_time(100);
+        qp_internal_animation_tick();
+    }
+}
+
+TEST_F(QuantumPainterDraw, DeltaTilesOnlyDrawChangedTiles) {
+    painter_image_handle_t tiles = qp_load_image_mem(gfx_anim_tiles);
+    painter_image_handle_t full  = qp_load_image_mem(gfx_anim_full);
+    ASSERT_NE(tiles, nullptr);
+    ASSERT_NE(full, nullptr);
+    ASSERT_EQ(full->frame_count, tiles->frame_count);
+
+    // Each frame drawn on top of the delta frames before it matches the same frame drawn in full
+    painter_bench_result_t tiles_result;
+    painter_bench_result_t full_result;
+    for (uint32_t frames = 1; frames <= tiles->frame_count; ++frames) {
+        animation = tiles;
+        painter_bench_run(render_animation, frames, &tiles_result);
+        qp_stop_animation(animation_token);
+        animation = full;
+        painter_bench_run(render_animation, frames, &full_result);
+        qp_stop_animation(animation_token);
+        EXPECT_EQ(full_result.checksum, tiles_result.checksum) << "frame " << frames - 1;
+    }
+
+    // Only the first frame is drawn in full, and the last only redraws the tiles around what moved
+    EXPECT_LT(tiles_result.pixels * 2, full_result.pixels);
+    EXPECT_GT(tiles_result.viewports, full_result.viewports);
+
+    qp_close_image(full);
+    qp_close_image(tiles);
+}
+
+TEST_F(QuantumPainterDraw, AsyncLinkMatchesGolden) {
+    // Drawing carries on while pixel data is in flight, which must never touch the buffer being sent
+    painter_bench_set_link(LINK_NS_PER_BYTE, true);
+    for (auto &s : scenes) {
+        painter_bench_result_t result;
+        painter_bench_run(s.render, 1, &result);
+        EXPECT_EQ(s.golden, result.checksum) << s.name;
+        EXPECT_EQ(0u, result.corrupt) << s.name;
+    }
+    painter_bench_set_link(0, false);
+}
+
+TEST_F(QuantumPainterDraw, AsyncLinkOverlapsDecoding) {
+    painter_bench_result_t sync_result;
+    painter_bench_result_t async_result;
+    painter_bench_set_link(LINK_NS_PER_BYTE, false);
+    painter_bench_run(render_images, LINK_ITERATIONS, &sync_result);
+    painter_bench_set_link(LINK_NS_PER_BYTE, true);
+    painter_bench_run(render_images, LINK_ITERATIONS, &async_result);
+    painter_bench_set_link(0, false);
+
+    painter_bench_print_header();
+    painter_bench_print("images (sync)", &sync_result);
+    painter_bench_print("images (async)", &async_result);
+    printf("link stall: sync %llu ns/iter, async %llu ns/iter\n", (unsigned long long)(sync_result.stall_ns / LINK_ITERATIONS), (unsigned long long)(async_result.stall_ns / LINK_ITERATIONS));
+
+    // The same pixels went over the link, but with the next buffer decoded while the previous one was sent
+    EXPECT_EQ(sync_result.checksum, async_result.checksum);
+    EXPECT_EQ(sync_result.pixels, async_result.pixels);
+    EXPECT_EQ(0u, async_result.corrupt);
+    EXPECT_LT(async_result.stall_ns, sync_result.stall_ns);
+}
+
+TEST_F(QuantumPainterDraw, PngExport) {
+    ASSERT_TRUE(qp_rect(device, 0, 0, WIDTH - 1, HEIGHT - 1, 0, 255, 255, true));
+
+    char path[] = "/tmp/qp_draw_XXXXXX";
+    int  fd     = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    ASSERT_TRUE(painter_bench_write_png(path));
+
+    // Signature, then the IHDR chunk holding the dimensions
+    uint8_t header[24];
+    FILE *  f = fopen(path, "rb");
+    ASSERT_NE(f, nullptr);
+    ASSERT_EQ(sizeof(header), fread(header, 1, sizeof(header), f));
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fclose(f);
+    remove(path);
+    EXPECT_EQ(0, memcmp(header, "\x89PNG\r\n\x1a\n\0\0\0\x0dIHDR", 16));
+    EXPECT_EQ(WIDTH, (header[16] << 24) | (header[17] << 16) | (header[18] << 8) | header[19]);
+    EXPECT_EQ(HEIGHT, (header[20] << 24) | (header[21] << 16) | (header[22] << 8) | header[23]);
+
+    // Stored deflate, so the file is at least as large as the raw RGB rows
+    EXPECT_GT(size, (long)HEIGHT * (1 + WIDTH * 3));
+}
+
+TEST_F(QuantumPainterDraw, Benchmark) {
+    painter_bench_print_header();
+    for (auto &s : scenes) {
+        painter_bench_result_t result;
+        painter_bench_run(s.render, BENCH_ITERATIONS, &result);
+        painter_bench_print(s.name, &result);
+        EXPECT_EQ(BENCH_ITERATIONS, result.iterations);
+        EXPECT_GT(result.pixels, 0u);
+    }
+}
@@ -0,0 +1,390 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <string.h>
+#include <stdio.h>
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_draw.h"
+#include "qp_rgb565_surface.h"
+#include "qp_palette_surface.h"
+#include "color.h"
+#include "lock-caps-ON.qgf.h"
+#include "thintel15.qff.h"
+}
+
+#define SURFACE_WIDTH 240
+#define SURFACE_HEIGHT 320
+
+static uint16_t         framebuffer[SURFACE_WIDTH * SURFACE_HEIGHT];
+static painter_device_t surface;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Capture display, which records what the surface sends to it
+
+struct capture_display_t {
+    painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
+
+    uint16_t panel[SURFACE_WIDTH * SURFACE_HEIGHT];
+    uint16_t viewport_l, viewport_t, viewport_r;
+    uint16_t pixdata_x, pixdata_y;
+
+    uint32_t viewport_count;
+    uint32_t bytes_sent;
+};
+
+static capture_display_t capture;
+
+static bool capture_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+static bool capture_power(painter_device_t device, bool power_on) {
+    return true;
+}
+
+static bool capture_clear(painter_device_t device) {
+    return true;
+}
+
+static bool capture_flush(painter_device_t device) {
+    return true;
+}
+
+static bool capture_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    capture.viewport_l = left;
+    capture.viewport_t = top;
+    capture.viewport_r = right;
+    capture.pixdata_x  = left;
+    capture.pixdata_y  = top;
+    capture.viewport_count++;
+    return true;
+}
+
+static bool capture_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    const uint16_t *pixels = (const uint16_t *)pixel_data;
+    for (uint32_t i = 0; i < native_pixel_count; ++i) {
+        capture.panel[capture.pixdata_y * SURFACE_WIDTH + capture.pixdata_x] = pixels[i];
+        if (++capture.pixdata_x > capture.viewport_r) {
+            capture.pixdata_x = capture.viewport_l;
+            capture.pixdata_y++;
+        }
+    }
+    capture.bytes_sent += native_pixel_count * sizeof(uint16_t);
+    return true;
+}
+
+// Same conversion as the RGB565 panels
+static bool capture_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    for (int16_t i = 0; i < palette_size; ++i) {
+        RGB      rgb      = hsv_to_rgb_nocie((HSV){palette[i].hsv888.h, palette[i].hsv888.s, palette[i].hsv888.v});
+        uint16_t rgb565   = (((uint16_t)rgb.r) >> 3) << 11 | (((uint16_t)rgb.g) >> 2) << 5 | (((uint16_t)rgb.b) >> 3);
+        palette[i].rgb565 = __builtin_bswap16(rgb565);
+    }
+    return true;
+}
+
+static bool capture_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    uint16_t *buf = (uint16_t *)target_buffer;
+    for (uint32_t i = 0; i < pixel_count; ++i) {
+        buf[pixel_offset + i] = palette[palette_indices[i]].rgb565;
+    }
+    return true;
+}
+
+static bool capture_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    return true;
+}
+
+static bool capture_comms_init(painter_device_t device) {
+    return true;
+}
+
+static bool capture_comms_start(painter_device_t device) {
+    return true;
+}
+
+static void capture_comms_stop(painter_device_t device) {}
+
+static uint32_t capture_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    return byte_count;
+}
+
+static const painter_driver_vtable_t capture_driver_vtable = {
+    .init            = capture_init,
+    .power           = capture_power,
+    .clear           = capture_clear,
+    .flush           = capture_flush,
+    .viewport        = capture_viewport,
+    .pixdata         = capture_pixdata,
+    .palette_convert = capture_palette_convert,
+    .append_pixels   = capture_append_pixels,
+    .append_pixdata  = capture_append_pixdata,
+};
+
+static painter_comms_vtable_t capture_comms_vtable = {
+    .comms_init  = capture_comms_init,
+    .comms_start = capture_comms_start,
+    .comms_stop  = capture_comms_stop,
+    .comms_send  = capture_comms_send,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+
+// Bytes a single bounding box around every changed pixel would have sent
+static uint32_t bounding_box_bytes(const uint16_t *before) {
+    uint16_t l = UINT16_MAX, t = UINT16_MAX, r = 0, b = 0;
+    for (uint16_t y = 0; y < SURFACE_HEIGHT; ++y) {
+        for (uint16_t x = 0; x < SURFACE_WIDTH; ++x) {
+            if (before[y * SURFACE_WIDTH + x] != framebuffer[y * SURFACE_WIDTH + x]) {
+                l = QP_MIN(l, x);
+                t = QP_MIN(t, y);
+                r = QP_MAX(r, x);
+                b = QP_MAX(b, y);
+            }
+        }
+    }
+    return (l > r) ? 0 : (uint32_t)(r - l + 1) * (b - t + 1) * sizeof(uint16_t);
+}
+
+class QuantumPainterSurface : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        // Surfaces come from a fixed pool, so create the one we need once
+        surface = qp_rgb565_make_surface(SURFACE_WIDTH, SURFACE_HEIGHT, framebuffer);
+
+        capture.base.driver_vtable         = &capture_driver_vtable;
+        capture.base.comms_vtable          = &capture_comms_vtable;
+        capture.base.native_bits_per_pixel = 16;
+        capture.base.panel_width           = SURFACE_WIDTH;
+        capture.base.panel_height          = SURFACE_HEIGHT;
+    }
+
+    void SetUp() override {
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init((painter_device_t)&capture, QP_ROTATION_0));
+        ASSERT_TRUE(qp_flush(surface));
+        memset(capture.panel, 0, sizeof(capture.panel));
+        memcpy(before, framebuffer, sizeof(framebuffer));
+    }
+
+    // Copies the surface out to the capture display, checking the panel ends up identical to the surface
+    void draw(const char *layout) {
+        capture.viewport_count = 0;
+        capture.bytes_sent     = 0;
+        ASSERT_TRUE(qp_rgb565_surface_draw(surface, (painter_device_t)&capture, 0, 0));
+        ASSERT_EQ(0, memcmp(capture.panel, framebuffer, sizeof(framebuffer)));
+        printf("%-24s %3u rects %7u bytes (single box: %7u bytes)\n", layout, (unsigned)capture.viewport_count, (unsigned)capture.bytes_sent, (unsigned)bounding_box_bytes(before));
+        memcpy(before, framebuffer, sizeof(framebuffer));
+    }
+
+    uint16_t before[SURFACE_WIDTH * SURFACE_HEIGHT];
+};
+
+TEST_F(QuantumPainterSurface, OppositeCornersAreSentSeparately) {
+    qp_rect(surface, 0, 0, 15, 15, 0, 255, 255, true);
+    qp_rect(surface, SURFACE_WIDTH - 16, SURFACE_HEIGHT - 16, SURFACE_WIDTH - 1, SURFACE_HEIGHT - 1, 85, 255, 255, true);
+    draw("opposite corners");
+    EXPECT_EQ(2u, capture.viewport_count);
+    EXPECT_EQ(2u * 16 * 16 * sizeof(uint16_t), capture.bytes_sent);
+}
+
+TEST_F(QuantumPainterSurface, AdjacentUpdatesAreMerged) {
+    // A progress bar filled in a segment at a time
+    for (uint16_t i = 0; i < 10; ++i) {
+        qp_rect(surface, 20 + i * 20, 100, 20 + i * 20 + 19, 109, 170, 255, 255, true);
+    }
+    draw("progress bar");
+    EXPECT_EQ(1u, capture.viewport_count);
+    EXPECT_EQ(200u * 10 * sizeof(uint16_t), capture.bytes_sent);
+}
+
+TEST_F(QuantumPainterSurface, TextGlyphsAreCoalesced) {
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr);
+    int16_t width = qp_drawtext(surface, 10, 200, font, "Layer: QWERTY");
+    ASSERT_GT(width, 0);
+    uint32_t single_box = bounding_box_bytes(before);
+    draw("text line");
+
+    // Each glyph is its own viewport, but neighbouring glyphs are merged back together
+    EXPECT_LE(capture.viewport_count, (uint32_t)QUANTUM_PAINTER_SURFACE_DIRTY_RECTS);
+    EXPECT_LE(capture.bytes_sent, single_box);
+    qp_close_font(font);
+}
+
+TEST_F(QuantumPainterSurface, ScatteredWidgetsStayWithinLimit) {
+    // Status indicators spread across the panel, more of them than there are dirty rectangles
+    static const uint16_t positions[][2] = {{4, 4}, {200, 4}, {4, 150}, {200, 150}, {100, 80}, {4, 290}, {200, 290}, {100, 220}};
+    for (auto &pos : positions) {
+        qp_rect(surface, pos[0], pos[1], pos[0] + 23, pos[1] + 11, 43, 255, 255, true);
+    }
+    uint32_t single_box = bounding_box_bytes(before);
+    draw("scattered indicators");
+    EXPECT_LE(capture.viewport_count, (uint32_t)QUANTUM_PAINTER_SURFACE_DIRTY_RECTS);
+    EXPECT_LT(capture.bytes_sent, single_box);
+}
+
+TEST_F(QuantumPainterSurface, UnchangedPixelsAreNotSent) {
+    qp_rect(surface, 50, 50, 99, 99, 0, 255, 255, true);
+    draw("first draw");
+
+    // Redrawing identical content leaves nothing to send
+    qp_rect(surface, 50, 50, 99, 99, 0, 255, 255, true);
+    draw("identical redraw");
+    EXPECT_EQ(0u, capture.viewport_count);
+    EXPECT_EQ(0u, capture.bytes_sent);
+}
+
+TEST_F(QuantumPainterSurface, DiagonalLineIsSplit) {
+    qp_line(surface, 0, 0, SURFACE_WIDTH - 1, SURFACE_HEIGHT - 1, 0, 0, 255);
+    uint32_t single_box = bounding_box_bytes(before);
+    draw("diagonal line");
+    EXPECT_LT(capture.bytes_sent, single_box);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Mono and palette surfaces
+
+#define SMALL_WIDTH 100
+#define SMALL_HEIGHT 60
+
+static uint8_t          mono_buffer[PALETTE_SURFACE_BUFFER_SIZE(SMALL_WIDTH, SMALL_HEIGHT, 1)];
+static uint8_t          palette4_buffer[PALETTE_SURFACE_BUFFER_SIZE(SMALL_WIDTH, SMALL_HEIGHT, 4)];
+static uint8_t          palette8_buffer[PALETTE_SURFACE_BUFFER_SIZE(SMALL_WIDTH, SMALL_HEIGHT, 8)];
+static HSV              palette4[16];
+static HSV              palette8[256];
+static painter_device_t mono_surface;
+static painter_device_t palette4_surface;
+static painter_device_t palette8_surface;
+
+static uint32_t fnv1a(const void *data, size_t size) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint32_t       hash  = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static uint8_t get_index(const uint8_t *buffer, uint32_t pixel, uint8_t bpp) {
+    uint32_t bit = pixel * bpp;
+    return (buffer[bit / 8] >> (bit % 8)) & ((1 << bpp) - 1);
+}
+
+// Draws a small status-screen style scene using each of the drawing primitives
+static void render_scene(painter_device_t device, painter_font_handle_t font, painter_image_handle_t image) {
+    qp_rect(device, 0, 0, SMALL_WIDTH - 1, SMALL_HEIGHT - 1, 0, 0, 0, true);
+    qp_rect(device, 2, 2, SMALL_WIDTH - 3, SMALL_HEIGHT - 3, 0, 0, 255, false);
+    qp_line(device, 4, 20, SMALL_WIDTH - 5, 20, 85, 255, 255);
+    qp_circle(device, 80, 40, 12, 170, 255, 255, true);
+    qp_ellipse(device, 30, 42, 20, 8, 43, 255, 255, false);
+    qp_drawtext_recolor(device, 6, 4, font, "Caps", 0, 0, 255, 0, 0, 0);
+    qp_drawimage(device, 60, 4, image);
+}
+
+class QuantumPainterPaletteSurface : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        // A handful of saturated hues plus a grayscale ramp
+        for (int i = 0; i < 16; ++i) {
+            palette4[i] = (i < 8) ? HSV{0, 0, (uint8_t)(i * 255 / 7)} : HSV{(uint8_t)((i - 8) * 32), 255, 255};
+        }
+        for (int i = 0; i < 256; ++i) {
+            palette8[i] = (i < 64) ? HSV{0, 0, (uint8_t)(i * 255 / 63)} : HSV{(uint8_t)(i * 4), (uint8_t)(255 - (i / 64 - 1) * 64), 255};
+        }
+
+        // Surfaces come from a fixed pool, so create the ones we need once
+        mono_surface     = qp_mono1bpp_make_surface(SMALL_WIDTH, SMALL_HEIGHT, mono_buffer);
+        palette4_surface = qp_palette_make_surface(SMALL_WIDTH, SMALL_HEIGHT, 4, palette4, palette4_buffer);
+        palette8_surface = qp_palette_make_surface(SMALL_WIDTH, SMALL_HEIGHT, 8, palette8, palette8_buffer);
+
+        capture.base.driver_vtable         = &capture_driver_vtable;
+        capture.base.comms_vtable          = &capture_comms_vtable;
+        capture.base.native_bits_per_pixel = 16;
+        capture.base.panel_width           = SURFACE_WIDTH;
+        capture.base.panel_height          = SURFACE_HEIGHT;
+    }
+
+    void SetUp() override {
+        ASSERT_NE(mono_surface, nullptr);
+        ASSERT_NE(palette4_surface, nullptr);
+        ASSERT_NE(palette8_surface, nullptr);
+        ASSERT_TRUE(qp_init(mono_surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(palette4_surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(palette8_surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init((painter_device_t)&capture, QP_ROTATION_0));
+        memset(capture.panel, 0, sizeof(capture.panel));
+        qp_internal_invalidate_palette();
+    }
+
+    // Renders the scene, checks it against the golden image, then checks a blit reproduces it on the capture display
+    void check_scene(painter_device_t device, const uint8_t *buffer, size_t buffer_size, uint8_t bpp, const HSV *palette, uint32_t golden) {
+        painter_font_handle_t  font  = qp_load_font_mem(font_thintel15);
+        painter_image_handle_t image = qp_load_image_mem(gfx_lock_caps_ON);
+        ASSERT_NE(font, nullptr);
+        ASSERT_NE(image, nullptr);
+        render_scene(device, font, image);
+        qp_close_image(image);
+        qp_close_font(font);
+        EXPECT_EQ(golden, fnv1a(buffer, buffer_size));
+
+        capture.viewport_count = 0;
+        capture.bytes_sent     = 0;
+        ASSERT_TRUE(qp_palette_surface_draw(device, (painter_device_t)&capture, 20, 30));
+
+        // Every surface pixel lands on the panel as its palette entry, and nothing outside the surface is touched
+        qp_pixel_t converted[256];
+        for (int i = 0; i < (1 << bpp); ++i) {
+            converted[i].hsv888 = {palette[i].h, palette[i].s, palette[i].v};
+        }
+        capture_palette_convert((painter_device_t)&capture, 1 << bpp, converted);
+        for (uint16_t y = 0; y < SURFACE_HEIGHT; ++y) {
+            for (uint16_t x = 0; x < SURFACE_WIDTH; ++x) {
+                bool     inside   = x >= 20 && x < 20 + SMALL_WIDTH && y >= 30 && y < 30 + SMALL_HEIGHT;
+                uint16_t expected = inside ? converted[get_index(buffer, (y - 30) * SMALL_WIDTH + (x - 20), bpp)].rgb565 : 0;
+                ASSERT_EQ(expected, capture.panel[y * SURFACE_WIDTH + x]) << "at " << x << "," << y;
+            }
+        }
+
+        // Once copied, nothing is left to send
+        capture.viewport_count = 0;
+        ASSERT_TRUE(qp_palette_surface_draw(device, (painter_device_t)&capture, 20, 30));
+        EXPECT_EQ(0u, capture.viewport_count);
+    }
+};
+
+TEST_F(QuantumPainterPaletteSurface, MonoPixelsArePacked) {
+    ASSERT_TRUE(qp_rect(mono_surface, 0, 0, 7, 0, 0, 0, 255, true));
+    ASSERT_TRUE(qp_setpixel(mono_surface, 3, 0, 0, 0, 100));
+    ASSERT_TRUE(qp_setpixel(mono_surface, 9, 0, 0, 0, 200));
+    EXPECT_EQ(0xF7, mono_buffer[0]);
+    EXPECT_EQ(0x02, mono_buffer[1]);
+}
+
+TEST_F(QuantumPainterPaletteSurface, ColorsMapToNearestEntry) {
+    // Exact palette entries, and something close to the third saturated hue
+    ASSERT_TRUE(qp_setpixel(palette4_surface, 0, 0, 0, 0, 255));
+    ASSERT_TRUE(qp_setpixel(palette4_surface, 1, 0, 64, 255, 255));
+    ASSERT_TRUE(qp_setpixel(palette4_surface, 2, 0, 66, 250, 250));
+    EXPECT_EQ(7, get_index(palette4_buffer, 0, 4));
+    EXPECT_EQ(10, get_index(palette4_buffer, 1, 4));
+    EXPECT_EQ(10, get_index(palette4_buffer, 2, 4));
+}
+
+TEST_F(QuantumPainterPaletteSurface, MonoSceneMatchesGolden) {
+    static const HSV mono_colors[2] = {{0, 0, 0}, {0, 0, 255}};
+    check_scene(mono_surface, mono_buffer, sizeof(mono_buffer), 1, mono_colors, 3906455128u);
+}
+
+TEST_F(QuantumPainterPaletteSurface, Palette4SceneMatchesGolden) {
+    check_scene(palette4_surface, palette4_buffer, sizeof(palette4_buffer), 4, palette4, 290655155u);
+}
+
+TEST_F(QuantumPainterPaletteSurface, Palette8SceneMatchesGolden) {
+    check_scene(palette8_surface, palette8_buffer, sizeof(palette8_buffer), 8, palette8, 2723739113u);
+}
@@ -0,0 +1,53 @@
+qp_codec_DEFS := -DQUANTUM_PAINTER_ENABLE -DQUANTUM_PAINTER_RGB565_SURFACE_ENABLE -DNO_PRINT -DNO_DEBUG
+
+qp_codec_INC := \
+	$(QUANTUM_PATH)/painter \
+	$(QUANTUM_PATH)/unicode \
+	$(DRIVER_PATH)/painter/generic \
+	keyboards/tzarc/djinn/graphics
+
+qp_codec_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/painter/tests/qp_codec_tests.cpp \
+	$(QUANTUM_PATH)/painter/qp.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c \
+	$(QUANTUM_PATH)/painter/qgf.c \
+	$(QUANTUM_PATH)/painter/qff.c \
+	$(QUANTUM_PATH)/painter/qp_draw_core.c \
+	$(QUANTUM_PATH)/painter/qp_draw_codec.c \
+	$(QUANTUM_PATH)/painter/qp_draw_circle.c \
+	$(QUANTUM_PATH)/painter/qp_draw_ellipse.c \
+	$(QUANTUM_PATH)/painter/qp_draw_image.c \
+	$(QUANTUM_PATH)/painter/qp_draw_text.c \
+	$(QUANTUM_PATH)/painter/qp_comms.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_dirty.c \
+	$(DRIVER_PATH)/painter/generic/qp_rgb565_surface.c \
+	$(QUANTUM_PATH)/deferred_exec.c \
+	$(QUANTUM_PATH)/unicode/utf8.c \
+	$(QUANTUM_PATH)/color.c \
+	keyboards/tzarc/djinn/graphics/djinn.qgf.c \
+	keyboards/tzarc/djinn/graphics/lock-caps-ON.qgf.c \
+	keyboards/tzarc/djinn/graphics/lock-num-OFF.qgf.c \
+	keyboards/tzarc/djinn/graphics/thintel15.qff.c \
+	$(QUANTUM_PATH)/painter/tests/graphics/dither-lz.qgf.c \
+	$(QUANTUM_PATH)/painter/tests/graphics/dither-raw.qgf.c
+
+qp_codec_glyph_cache_DEFS := $(qp_codec_DEFS) -DQUANTUM_PAINTER_GLYPH_CACHE_ENTRIES=32
+qp_codec_glyph_cache_INC := $(qp_codec_INC)
+qp_codec_glyph_cache_SRC := $(qp_codec_SRC)
+
+qp_surface_DEFS := $(qp_codec_DEFS) -DQUANTUM_PAINTER_PALETTE_SURFACE_ENABLE -DPALETTE_SURFACE_NUM_DEVICES=3 -DQUANTUM_PAINTER_SUPPORTS_256_PALETTE=1
+qp_surface_INC := $(qp_codec_INC)
+qp_surface_SRC := $(filter-out $(QUANTUM_PATH)/painter/tests/qp_codec_tests.cpp,$(qp_codec_SRC)) \
+	$(DRIVER_PATH)/painter/generic/qp_palette_surface.c \
+	$(QUANTUM_PATH)/painter/tests/qp_surface_tests.cpp
+
+qp_draw_DEFS := $(qp_codec_DEFS) \
+	-DQUANTUM_PAINTER_PIXDATA_BUFFER_COUNT=2
+qp_draw_INC := $(qp_codec_INC) \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)
+qp_draw_SRC := $(filter-out $(QUANTUM_PATH)/painter/tests/qp_codec_tests.cpp,$(qp_codec_SRC)) \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/painter_bench.c \
+	$(QUANTUM_PATH)/painter/tests/graphics/anim-tiles.qgf.c \
+	$(QUANTUM_PATH)/painter/tests/graphics/anim-full.qgf.c \
+	$(QUANTUM_PATH)/painter/tests/qp_draw_tests.cpp
@@ -0,0 +1,4 @@
+TEST_LIST += qp_codec
+TEST_LIST += qp_codec_glyph_cache
+TEST_LIST += qp_surface
+TEST_LIST += qp_draw
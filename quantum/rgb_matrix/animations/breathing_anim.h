@@ -5,10 +5,17 @@ RGB_MATRIX_EFFECT(BREATHING)
 bool BREATHING(effect_params_t* params) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
-    HSV      hsv  = rgb_matrix_config.hsv;
-    uint16_t time = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 8);
-    hsv.v         = scale8(abs8(sin8(time) - 128) * 2, hsv.v);
-    RGB rgb       = rgb_matrix_hsv_to_rgb(hsv);
+    HSV      hsv    = rgb_matrix_config.hsv;
+    uint16_t time   = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 8);
+    uint8_t  breath = abs8(sin8(time) - 128) * 2;
+#        ifdef RGB_MATRIX_HW_BREATHING
+    // let the driver dim the whole matrix so the PWM buffer stays untouched
+    if (rgb_matrix_set_global_brightness(breath)) {
+        breath = UINT8_MAX;
+    }
+#        endif
+    hsv.v   = scale8(breath, hsv.v);
+    RGB rgb = rgb_matrix_hsv_to_rgb(hsv);
     for (uint8_t i = led_min; i < led_max; i++) {
         RGB_MATRIX_TEST_LED_FLAGS();
         rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
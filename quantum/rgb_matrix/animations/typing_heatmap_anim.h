@@ -16,35 +16,133 @@ RGB_MATRIX_EFFECT(TYPING_HEATMAP)
 #        ifndef RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT
 #            define RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT 16
 #        endif
-void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
-#        ifdef RGB_MATRIX_TYPING_HEATMAP_SLIM
-    // Limit effect to pressed keys
-    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
-#        else
-    if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
-        return;
+#        ifndef RGB_MATRIX_TYPING_HEATMAP_SLIM
+// Returns how much heat a press on `from` spreads to `to`, or zero if `to` is out of reach.
+static uint8_t typing_heatmap_spread_amount(led_point_t from, led_point_t to) {
+    int16_t dx = (int16_t)from.x - (int16_t)to.x;
+    int16_t dy = (int16_t)from.y - (int16_t)to.y;
+    // Cheap bounding box rejection before paying for the square root
+    if (dx > RGB_MATRIX_TYPING_HEATMAP_SPREAD || dx < -RGB_MATRIX_TYPING_HEATMAP_SPREAD || dy > RGB_MATRIX_TYPING_HEATMAP_SPREAD || dy < -RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+        return 0;
     }
+    uint8_t distance = sqrt16((dx * dx) + (dy * dy));
+    if (distance > RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+        return 0;
+    }
+    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
+    if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
+        amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
+    }
+    return amount;
+}
+
+static void typing_heatmap_spread_scan(uint8_t row, uint8_t col) {
+    led_point_t from = g_led_config.point[g_led_config.matrix_co[row][col]];
     for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
         for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
             if (g_led_config.matrix_co[i_row][i_col] == NO_LED) { // skip as target key doesn't have an led position
                 continue;
             }
             if (i_row == row && i_col == col) {
-                g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
-            } else {
-#            define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
-                uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
-#            undef LED_DISTANCE
-                if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
-                    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
-                    if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
-                        amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
-                    }
-                    g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
+                continue;
+            }
+            uint8_t amount = typing_heatmap_spread_amount(from, g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
+            if (amount) {
+                g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
+            }
+        }
+    }
+}
+
+#            ifdef RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_CACHE_SIZE
+#                if MATRIX_ROWS * MATRIX_COLS > UINT8_MAX
+typedef uint16_t heatmap_matrix_pos_t;
+#                else
+typedef uint8_t heatmap_matrix_pos_t;
+#                endif
+
+typedef struct {
+    heatmap_matrix_pos_t pos; // row * MATRIX_COLS + col
+    uint8_t              amount;
+} heatmap_neighbor_t;
+
+// Neighbor lists for each LED, stored back to back. The list for LED `i` lives between
+// `heatmap_neighbor_start[i]` and `heatmap_neighbor_start[i + 1]`. LEDs whose list did not
+// fit into the cache are marked with `heatmap_neighbor_overflow` and fall back to a full scan.
+// A list holds every matrix position in reach, including those of the LED itself, as an LED may be
+// wired to more than one key; the pressed position is skipped when the list is applied.
+static heatmap_neighbor_t heatmap_neighbors[RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_CACHE_SIZE];
+static uint16_t           heatmap_neighbor_start[RGB_MATRIX_LED_COUNT + 1];
+static uint8_t            heatmap_neighbor_overflow[(RGB_MATRIX_LED_COUNT + 7) / 8];
+static bool               heatmap_neighbors_built = false;
+
+static void typing_heatmap_build_neighbors(void) {
+    uint16_t count = 0;
+    memset(heatmap_neighbor_overflow, 0, sizeof heatmap_neighbor_overflow);
+    for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+        heatmap_neighbor_start[led] = count;
+        uint16_t first              = count;
+        bool     overflow           = false;
+        for (uint8_t i_row = 0; i_row < MATRIX_ROWS && !overflow; i_row++) {
+            for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
+                uint8_t target = g_led_config.matrix_co[i_row][i_col];
+                if (target == NO_LED) {
+                    continue;
+                }
+                uint8_t amount = typing_heatmap_spread_amount(g_led_config.point[led], g_led_config.point[target]);
+                if (!amount) {
+                    continue;
+                }
+                if (count >= RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_CACHE_SIZE) {
+                    overflow = true;
+                    break;
                 }
+                heatmap_neighbors[count].pos    = i_row * MATRIX_COLS + i_col;
+                heatmap_neighbors[count].amount = amount;
+                count++;
             }
         }
+        if (overflow) {
+            // Give the space back so later LEDs may still fit
+            count = first;
+            heatmap_neighbor_overflow[led / 8] |= 1 << (led % 8);
+        }
+    }
+    heatmap_neighbor_start[RGB_MATRIX_LED_COUNT] = count;
+    heatmap_neighbors_built                      = true;
+}
+#            endif // RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_CACHE_SIZE
+#        endif     // RGB_MATRIX_TYPING_HEATMAP_SLIM
+
+void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
+#        ifdef RGB_MATRIX_TYPING_HEATMAP_SLIM
+    // Limit effect to pressed keys
+    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+#        else
+    uint8_t led = g_led_config.matrix_co[row][col];
+    if (led == NO_LED) { // skip as pressed key doesn't have an led position
+        return;
     }
+    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+
+#            ifdef RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_CACHE_SIZE
+    if (!heatmap_neighbors_built) {
+        typing_heatmap_build_neighbors();
+    }
+    if (!(heatmap_neighbor_overflow[led / 8] & (1 << (led % 8)))) {
+        uint8_t             *frame_buffer = &g_rgb_frame_buffer[0][0];
+        heatmap_matrix_pos_t pressed      = row * MATRIX_COLS + col;
+        for (uint16_t i = heatmap_neighbor_start[led]; i < heatmap_neighbor_start[led + 1]; i++) {
+            heatmap_matrix_pos_t pos = heatmap_neighbors[i].pos;
+            if (pos == pressed) {
+                continue;
+            }
+            frame_buffer[pos] = qadd8(frame_buffer[pos], heatmap_neighbors[i].amount);
+        }
+        return;
+    }
+#            endif // RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_CACHE_SIZE
+    typing_heatmap_spread_scan(row, col);
 #        endif
 }
 
@@ -62,7 +160,7 @@ bool TYPING_HEATMAP(effect_params_t* params) {
     }
 
     // The heatmap animation might run in several iterations depending on
-    // `RGB_MATRIX_LED_PROCESS_LIMIT`, therefore we only want to update the
+    // `RGB_MATRIX_LED_PROCESS_LIMIT` or `RGB_MATRIX_RENDER_BUDGET_US`, therefore we only want to update the
     // timer when the animation starts.
     if (params->iter == 0) {
         decrease_heatmap_values = timer_elapsed(heatmap_decrease_timer) >= RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS;
@@ -75,13 +173,19 @@ bool TYPING_HEATMAP(effect_params_t* params) {
 
     // Render heatmap & decrease
     uint8_t count = 0;
-    for (uint8_t row = 0; row < MATRIX_ROWS && count < RGB_MATRIX_LED_PROCESS_LIMIT; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS && RGB_MATRIX_LED_PROCESS_LIMIT; col++) {
+    for (uint8_t row = 0; row < MATRIX_ROWS && count < led_max - led_min; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS && count < led_max - led_min; col++) {
             if (g_led_config.matrix_co[row][col] >= led_min && g_led_config.matrix_co[row][col] < led_max) {
                 count++;
                 uint8_t val = g_rgb_frame_buffer[row][col];
                 if (!HAS_ANY_FLAGS(g_led_config.flags[g_led_config.matrix_co[row][col]], params->flags)) continue;
 
+                // Cold keys are always off and have nothing left to decrease
+                if (!val) {
+                    rgb_matrix_set_color(g_led_config.matrix_co[row][col], 0, 0, 0);
+                    continue;
+                }
+
                 HSV hsv = {170 - qsub8(val, 85), rgb_matrix_config.hsv.s, scale8((qadd8(170, val) - 170) * 3, rgb_matrix_config.hsv.v)};
                 RGB rgb = rgb_matrix_hsv_to_rgb(hsv);
                 rgb_matrix_set_color(g_led_config.matrix_co[row][col], rgb.r, rgb.g, rgb.b);
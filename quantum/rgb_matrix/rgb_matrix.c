@@ -28,6 +28,12 @@
 #include <stdlib.h>
 
 #include <lib/lib8tion/lib8tion.h>
+#if defined(RGB_MATRIX_HW_BREATHING) && defined(USE_CIE1931_CURVE)
+#    include "led_tables.h"
+#endif
+#if defined(RGB_MATRIX_RENDER_BUDGET_US) && defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#endif
 
 #ifndef RGB_MATRIX_CENTER
 const led_point_t k_rgb_matrix_center = {112, 32};
@@ -119,6 +125,10 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+uint8_t g_rgb_render_led_min   = 0;
+uint8_t g_rgb_render_led_count = RGB_MATRIX_LED_PROCESS_LIMIT;
+#endif // RGB_MATRIX_RENDER_BUDGET_US
 
 // internals
 static bool            suspend_state     = false;
@@ -129,6 +139,12 @@ static rgb_task_states rgb_task_state    = SYNCING;
 #if RGB_MATRIX_TIMEOUT > 0
 static uint32_t rgb_anykey_timer;
 #endif // RGB_MATRIX_TIMEOUT > 0
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+static uint16_t rgb_render_led_cost = 0; // running estimate of the render time per LED, in 1/16us, 0 until measured
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+#ifdef RGB_MATRIX_HW_BREATHING
+static bool rgb_global_brightness_claimed = false;
+#endif // RGB_MATRIX_HW_BREATHING
 
 // double buffers
 static uint32_t rgb_timer_buffer;
@@ -193,15 +209,45 @@ uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
 }
 
 void rgb_matrix_update_pwm_buffers(void) {
+#ifdef RGB_MATRIX_OVERLAY_LAYERS
+    rgb_matrix_composite_flush();
+#endif // RGB_MATRIX_OVERLAY_LAYERS
+#ifdef RGB_MATRIX_OUTPUT_STAGE
+    rgb_matrix_output_flush();
+#endif // RGB_MATRIX_OUTPUT_STAGE
     rgb_matrix_driver.flush();
 }
 
+#ifdef RGB_MATRIX_HW_BREATHING
+bool rgb_matrix_set_global_brightness(uint8_t value) {
+    if (!rgb_matrix_driver.set_global_brightness) {
+        return false;
+    }
+#    ifdef USE_CIE1931_CURVE
+    // the curve is close to a power law, so scaling the current by the
+    // corrected value matches scaling V before correction
+    value = pgm_read_byte(&CIE1931_CURVE[value]);
+#    endif
+    rgb_matrix_driver.set_global_brightness(value);
+    rgb_global_brightness_claimed = true;
+    return true;
+}
+#endif // RGB_MATRIX_HW_BREATHING
+
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#if defined(RGB_MATRIX_OVERLAY_LAYERS)
+    rgb_matrix_composite_set_color(index, red, green, blue);
+#elif defined(RGB_MATRIX_OUTPUT_STAGE)
+    rgb_matrix_output_set_color(index, red, green, blue);
+#else
     rgb_matrix_driver.set_color(index, red, green, blue);
+#endif
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
-#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+#if defined(RGB_MATRIX_OVERLAY_LAYERS)
+    rgb_matrix_composite_set_color_all(red, green, blue);
+#elif defined(RGB_MATRIX_OUTPUT_STAGE) || (defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT))
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
@@ -341,14 +387,79 @@ static void rgb_task_start(void) {
     rgb_task_state = RENDERING;
 }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+#    ifdef PROTOCOL_CHIBIOS
+__attribute__((weak)) uint32_t rgb_matrix_render_timer_us(void) {
+    // Accumulate tick differences, so the result keeps counting across a wrap
+    // of the system time, whatever its width
+    static systime_t last;
+    static uint32_t  elapsed_us;
+
+    systime_t now = chVTGetSystemTimeX();
+    elapsed_us += TIME_I2US(chTimeDiffX(last, now));
+    last = now;
+    return elapsed_us;
+}
+#    else
+__attribute__((weak)) uint32_t rgb_matrix_render_timer_us(void) {
+    // Placeholder with millisecond resolution: most chunks measure as zero,
+    // so boards with a finer counter should override this
+    return timer_read32() * 1000;
+}
+#    endif
+
+static void rgb_render_budget_next_chunk(void) {
+    if (rgb_effect_params.iter == 0) {
+        g_rgb_render_led_min = 0;
+    } else {
+        g_rgb_render_led_min = (RGB_MATRIX_LED_COUNT - g_rgb_render_led_min > g_rgb_render_led_count) ? g_rgb_render_led_min + g_rgb_render_led_count : RGB_MATRIX_LED_COUNT;
+    }
+
+    if (rgb_render_led_cost == 0) {
+        // Nothing measured yet, start out with the fixed chunk size
+        g_rgb_render_led_count = RGB_MATRIX_LED_PROCESS_LIMIT;
+    } else {
+        uint32_t count         = ((uint32_t)RGB_MATRIX_RENDER_BUDGET_US * 16) / rgb_render_led_cost;
+        g_rgb_render_led_count = count < 1 ? 1 : (count > RGB_MATRIX_LED_COUNT ? RGB_MATRIX_LED_COUNT : count);
+    }
+}
+
+static void rgb_render_budget_update(uint32_t elapsed_us) {
+    uint8_t count = RGB_MATRIX_LED_COUNT - g_rgb_render_led_min;
+    if (count > g_rgb_render_led_count) count = g_rgb_render_led_count;
+    if (count == 0) return;
+
+    uint32_t sample = (elapsed_us * 16) / count;
+    if (sample > UINT16_MAX) sample = UINT16_MAX;
+    if (sample == 0) sample = 1;
+
+    if (rgb_render_led_cost == 0) {
+        rgb_render_led_cost = sample;
+    } else {
+        // Exponential moving average, weighting the new sample by 1/8
+        rgb_render_led_cost = (int32_t)rgb_render_led_cost + (((int32_t)sample - (int32_t)rgb_render_led_cost) / 8);
+        if (rgb_render_led_cost == 0) rgb_render_led_cost = 1;
+    }
+}
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
 static void rgb_task_render(uint8_t effect) {
     bool rendering         = false;
+#ifdef RGB_MATRIX_OVERLAY_LAYERS
+    // the running effect always draws on the base layer
+    rgb_matrix_overlay_end();
+#endif // RGB_MATRIX_OVERLAY_LAYERS
     rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
     if (rgb_effect_params.flags != rgb_matrix_config.flags) {
         rgb_effect_params.flags = rgb_matrix_config.flags;
         rgb_matrix_set_color_all(0, 0, 0);
     }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_render_budget_next_chunk();
+    uint32_t render_start = rgb_matrix_render_timer_us();
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
     switch (effect) {
@@ -389,6 +500,10 @@ static void rgb_task_render(uint8_t effect) {
             return;
     }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_render_budget_update(rgb_matrix_render_timer_us() - render_start);
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
     rgb_effect_params.iter++;
 
     // next task
@@ -406,6 +521,19 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
 
+#ifdef RGB_MATRIX_HW_BREATHING
+    // hand the full range back once no effect drives the global brightness
+    if (!rgb_global_brightness_claimed) {
+        rgb_matrix_set_global_brightness(UINT8_MAX);
+    }
+    rgb_global_brightness_claimed = false;
+#endif // RGB_MATRIX_HW_BREATHING
+
+#ifdef RGB_MATRIX_OVERLAY_LAYERS
+    // overlays go dark along with the effect when disabled or suspended
+    rgb_matrix_composite_show_overlays(effect != RGB_MATRIX_NONE);
+#endif // RGB_MATRIX_OVERLAY_LAYERS
+
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
 
@@ -434,7 +562,11 @@ void rgb_matrix_task(void) {
             rgb_task_render(effect);
             if (effect) {
                 // Only run the basic indicators in the last render iteration (default there are 5 iterations)
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+                if (rgb_task_state == FLUSHING) {
+#else
                 if (rgb_effect_params.iter == RGB_MATRIX_LED_PROCESS_MAX_ITERATIONS) {
+#endif // RGB_MATRIX_RENDER_BUDGET_US
                     rgb_matrix_indicators();
                 }
                 rgb_matrix_indicators_advanced(&rgb_effect_params);
@@ -481,6 +613,16 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
 
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
+#ifdef RGB_MATRIX_OVERLAY_LAYERS
+    rgb_matrix_composite_init();
+#endif // RGB_MATRIX_OVERLAY_LAYERS
+#ifdef RGB_MATRIX_OUTPUT_STAGE
+    rgb_matrix_output_init();
+#endif // RGB_MATRIX_OUTPUT_STAGE
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    // measure again, starting out with the fixed chunk size
+    rgb_render_led_cost = 0;
+#endif // RGB_MATRIX_RENDER_BUDGET_US
 
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
@@ -21,6 +21,8 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "rgb_matrix_types.h"
+#include "rgb_matrix_composite.h"
+#include "rgb_matrix_output.h"
 #include "color.h"
 #include "keyboard.h"
 
@@ -53,7 +55,23 @@
 #endif
 #define RGB_MATRIX_LED_PROCESS_MAX_ITERATIONS ((RGB_MATRIX_LED_COUNT + RGB_MATRIX_LED_PROCESS_LIMIT - 1) / RGB_MATRIX_LED_PROCESS_LIMIT)
 
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
+#if defined(RGB_MATRIX_RENDER_BUDGET_US)
+// The chunk rendered by each task run is sized at runtime, see rgb_matrix_task()
+extern uint8_t g_rgb_render_led_min;
+extern uint8_t g_rgb_render_led_count;
+#    if defined(RGB_MATRIX_SPLIT)
+#        define RGB_MATRIX_USE_LIMITS_ITER(min, max, iter)                                                                                      \
+            uint8_t min = g_rgb_render_led_min;                                                                                                 \
+            uint8_t max = (RGB_MATRIX_LED_COUNT - min > g_rgb_render_led_count) ? min + g_rgb_render_led_count : RGB_MATRIX_LED_COUNT; \
+            uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;                                                                                  \
+            if (is_keyboard_left() && (max > k_rgb_matrix_split[0])) max = k_rgb_matrix_split[0];                                              \
+            if (!(is_keyboard_left()) && (min < k_rgb_matrix_split[0])) min = k_rgb_matrix_split[0];
+#    else
+#        define RGB_MATRIX_USE_LIMITS_ITER(min, max, iter) \
+            uint8_t min = g_rgb_render_led_min;            \
+            uint8_t max = (RGB_MATRIX_LED_COUNT - min > g_rgb_render_led_count) ? min + g_rgb_render_led_count : RGB_MATRIX_LED_COUNT;
+#    endif
+#elif defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
 #    if defined(RGB_MATRIX_SPLIT)
 #        define RGB_MATRIX_USE_LIMITS_ITER(min, max, iter)                                        \
             uint8_t min = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);                                  \
@@ -131,6 +149,10 @@ void process_rgb_matrix(uint8_t row, uint8_t col, bool pressed);
 
 void rgb_matrix_task(void);
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+uint32_t rgb_matrix_render_timer_us(void);
+#endif
+
 // This runs after another backlight effect and replaces
 // colors already set
 void rgb_matrix_indicators(void);
@@ -189,6 +211,9 @@ void        rgb_matrix_decrease_speed_noeeprom(void);
 led_flags_t rgb_matrix_get_flags(void);
 void        rgb_matrix_set_flags(led_flags_t flags);
 void        rgb_matrix_set_flags_noeeprom(led_flags_t flags);
+#ifdef RGB_MATRIX_HW_BREATHING
+bool rgb_matrix_set_global_brightness(uint8_t value);
+#endif
 
 #ifndef RGBLIGHT_ENABLE
 #    define eeconfig_update_rgblight_current eeconfig_update_rgb_matrix
@@ -243,6 +268,10 @@ typedef struct {
     void (*set_color_all)(uint8_t r, uint8_t g, uint8_t b);
     /* Flush any buffered changes to the hardware. */
     void (*flush)(void);
+#ifdef RGB_MATRIX_HW_BREATHING
+    /* Scale every LED in hardware, 0 (off) to 255 (full), on the next flush. Optional. */
+    void (*set_global_brightness)(uint8_t value);
+#endif
 } rgb_matrix_driver_t;
 
 static inline bool rgb_matrix_check_finished_leds(uint8_t led_idx) {
@@ -0,0 +1,176 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+#include <string.h>
+#include <lib/lib8tion/lib8tion.h>
+
+#ifdef RGB_MATRIX_OVERLAY_LAYERS
+
+/* The running effect renders into the base layer, and each overlay layer
+ * holds a color and alpha per LED on top of it. rgb_matrix_set_color() writes
+ * to the current target, so code run between rgb_matrix_overlay_begin() and
+ * rgb_matrix_overlay_end() renders into an overlay instead of the base.
+ * Writes that change a layer mark the LED dirty, and only dirty LEDs are blended and handed to the
+ * driver when the frame is flushed, so a static overlay costs nothing once
+ * drawn and the effect underneath never has to repaint around it.
+ */
+
+typedef struct {
+    RGB                     color[RGB_MATRIX_LED_COUNT];
+    uint8_t                 alpha[RGB_MATRIX_LED_COUNT];
+    rgb_matrix_blend_mode_t mode;
+} rgb_overlay_layer_t;
+
+static RGB                 rgb_base_layer[RGB_MATRIX_LED_COUNT];
+static rgb_overlay_layer_t rgb_overlay_layers[RGB_MATRIX_OVERLAY_LAYERS];
+static uint8_t             rgb_composite_dirty[(RGB_MATRIX_LED_COUNT + 7) / 8];
+static bool                rgb_composite_any_dirty;
+static bool                rgb_overlays_visible = true;
+static uint8_t             rgb_composite_target = RGB_MATRIX_BASE_LAYER;
+static uint8_t             rgb_composite_target_alpha;
+
+static inline void rgb_composite_mark_dirty(uint8_t index) {
+    rgb_composite_dirty[index / 8] |= 1 << (index % 8);
+    rgb_composite_any_dirty = true;
+}
+
+static inline void rgb_composite_mark_all_dirty(void) {
+    memset(rgb_composite_dirty, 0xFF, sizeof(rgb_composite_dirty));
+    rgb_composite_any_dirty = true;
+}
+
+void rgb_matrix_composite_init(void) {
+    memset(rgb_base_layer, 0, sizeof(rgb_base_layer));
+    memset(rgb_overlay_layers, 0, sizeof(rgb_overlay_layers));
+    rgb_composite_mark_all_dirty();
+}
+
+void rgb_matrix_composite_set_base(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    if (index < 0 || index >= RGB_MATRIX_LED_COUNT) return;
+
+    RGB *led = &rgb_base_layer[index];
+    if (led->r == red && led->g == green && led->b == blue) return;
+
+    led->r = red;
+    led->g = green;
+    led->b = blue;
+    rgb_composite_mark_dirty(index);
+}
+
+void rgb_matrix_composite_set_base_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_matrix_composite_set_base(i, red, green, blue);
+    }
+}
+
+void rgb_matrix_composite_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    if (rgb_composite_target == RGB_MATRIX_BASE_LAYER) {
+        rgb_matrix_composite_set_base(index, red, green, blue);
+    } else {
+        rgb_matrix_overlay_set_color(rgb_composite_target, index, red, green, blue, rgb_composite_target_alpha);
+    }
+}
+
+void rgb_matrix_composite_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    if (rgb_composite_target == RGB_MATRIX_BASE_LAYER) {
+        rgb_matrix_composite_set_base_all(red, green, blue);
+    } else {
+        rgb_matrix_overlay_set_color_all(rgb_composite_target, red, green, blue, rgb_composite_target_alpha);
+    }
+}
+
+void rgb_matrix_composite_show_overlays(bool visible) {
+    if (rgb_overlays_visible == visible) return;
+
+    rgb_overlays_visible = visible;
+    rgb_composite_mark_all_dirty();
+}
+
+void rgb_matrix_overlay_set_color(uint8_t layer, int index, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha) {
+    if (layer >= RGB_MATRIX_OVERLAY_LAYERS || index < 0 || index >= RGB_MATRIX_LED_COUNT) return;
+
+    rgb_overlay_layer_t *overlay = &rgb_overlay_layers[layer];
+    RGB                 *led     = &overlay->color[index];
+    if (overlay->alpha[index] == alpha && (alpha == 0 || (led->r == red && led->g == green && led->b == blue))) return;
+
+    led->r                = red;
+    led->g                = green;
+    led->b                = blue;
+    overlay->alpha[index] = alpha;
+    rgb_composite_mark_dirty(index);
+}
+
+void rgb_matrix_overlay_set_color_all(uint8_t layer, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_matrix_overlay_set_color(layer, i, red, green, blue, alpha);
+    }
+}
+
+void rgb_matrix_overlay_clear(uint8_t layer) {
+    rgb_matrix_overlay_set_color_all(layer, 0, 0, 0, 0);
+}
+
+void rgb_matrix_overlay_begin(uint8_t layer, uint8_t alpha) {
+    rgb_composite_target       = layer < RGB_MATRIX_OVERLAY_LAYERS ? layer : RGB_MATRIX_BASE_LAYER;
+    rgb_composite_target_alpha = alpha;
+}
+
+void rgb_matrix_overlay_end(void) {
+    rgb_composite_target = RGB_MATRIX_BASE_LAYER;
+}
+
+void rgb_matrix_overlay_set_blend_mode(uint8_t layer, rgb_matrix_blend_mode_t mode) {
+    if (layer >= RGB_MATRIX_OVERLAY_LAYERS || rgb_overlay_layers[layer].mode == mode) return;
+
+    rgb_overlay_layers[layer].mode = mode;
+    rgb_composite_mark_all_dirty();
+}
+
+static inline uint8_t rgb_composite_blend_channel(rgb_matrix_blend_mode_t mode, uint8_t below, uint8_t above, uint8_t alpha) {
+    switch (mode) {
+        case RGB_MATRIX_BLEND_ADD:
+            return qadd8(below, scale8(above, alpha));
+        case RGB_MATRIX_BLEND_MULTIPLY:
+            return blend8(below, scale8(below, above), alpha);
+        default:
+            return blend8(below, above, alpha);
+    }
+}
+
+static RGB rgb_composite_led(uint8_t index) {
+    RGB rgb = rgb_base_layer[index];
+    if (!rgb_overlays_visible) return rgb;
+
+    for (uint8_t layer = 0; layer < RGB_MATRIX_OVERLAY_LAYERS; layer++) {
+        rgb_overlay_layer_t *overlay = &rgb_overlay_layers[layer];
+        uint8_t              alpha   = overlay->alpha[index];
+        if (alpha == 0) continue;
+
+        RGB above = overlay->color[index];
+        rgb.r     = rgb_composite_blend_channel(overlay->mode, rgb.r, above.r, alpha);
+        rgb.g     = rgb_composite_blend_channel(overlay->mode, rgb.g, above.g, alpha);
+        rgb.b     = rgb_composite_blend_channel(overlay->mode, rgb.b, above.b, alpha);
+    }
+    return rgb;
+}
+
+void rgb_matrix_composite_flush(void) {
+    if (!rgb_composite_any_dirty) return;
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        if (!(rgb_composite_dirty[i / 8] & (1 << (i % 8)))) continue;
+
+        RGB rgb = rgb_composite_led(i);
+#    ifdef RGB_MATRIX_OUTPUT_STAGE
+        rgb_matrix_output_set_color(i, rgb.r, rgb.g, rgb.b);
+#    else
+        rgb_matrix_driver.set_color(i, rgb.r, rgb.g, rgb.b);
+#    endif
+    }
+
+    memset(rgb_composite_dirty, 0, sizeof(rgb_composite_dirty));
+    rgb_composite_any_dirty = false;
+}
+
+#endif // RGB_MATRIX_OVERLAY_LAYERS
@@ -0,0 +1,34 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef RGB_MATRIX_OVERLAY_LAYERS
+
+#    define RGB_MATRIX_BASE_LAYER UINT8_MAX
+
+typedef enum rgb_matrix_blend_mode_t {
+    RGB_MATRIX_BLEND_NORMAL,   // mix the overlay over the layers below by its alpha
+    RGB_MATRIX_BLEND_ADD,      // add the overlay, scaled by its alpha, to the layers below
+    RGB_MATRIX_BLEND_MULTIPLY, // darken the layers below by the overlay, scaled by its alpha
+} rgb_matrix_blend_mode_t;
+
+void rgb_matrix_composite_init(void);
+void rgb_matrix_composite_set_base(int index, uint8_t red, uint8_t green, uint8_t blue);
+void rgb_matrix_composite_set_base_all(uint8_t red, uint8_t green, uint8_t blue);
+void rgb_matrix_composite_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
+void rgb_matrix_composite_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
+void rgb_matrix_composite_show_overlays(bool visible);
+void rgb_matrix_composite_flush(void);
+
+void rgb_matrix_overlay_set_color(uint8_t layer, int index, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha);
+void rgb_matrix_overlay_set_color_all(uint8_t layer, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha);
+void rgb_matrix_overlay_clear(uint8_t layer);
+void rgb_matrix_overlay_begin(uint8_t layer, uint8_t alpha);
+void rgb_matrix_overlay_end(void);
+void rgb_matrix_overlay_set_blend_mode(uint8_t layer, rgb_matrix_blend_mode_t mode);
+
+#endif // RGB_MATRIX_OVERLAY_LAYERS
@@ -269,12 +269,16 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 #    elif defined(IS31FL3733)
 static void flush(void) {
     is31fl3733_update_pwm_buffers(DRIVER_ADDR_1, 0);
+    is31fl3733_update_global_current(DRIVER_ADDR_1, 0);
 #        if defined(DRIVER_ADDR_2)
     is31fl3733_update_pwm_buffers(DRIVER_ADDR_2, 1);
+    is31fl3733_update_global_current(DRIVER_ADDR_2, 1);
 #            if defined(DRIVER_ADDR_3)
     is31fl3733_update_pwm_buffers(DRIVER_ADDR_3, 2);
+    is31fl3733_update_global_current(DRIVER_ADDR_3, 2);
 #                if defined(DRIVER_ADDR_4)
     is31fl3733_update_pwm_buffers(DRIVER_ADDR_4, 3);
+    is31fl3733_update_global_current(DRIVER_ADDR_4, 3);
 #                endif
 #            endif
 #        endif
@@ -285,6 +289,9 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush = flush,
     .set_color = is31fl3733_set_color,
     .set_color_all = is31fl3733_set_color_all,
+#        ifdef RGB_MATRIX_HW_BREATHING
+    .set_global_brightness = is31fl3733_set_global_current,
+#        endif
 };
 
 #    elif defined(IS31FL3736)
@@ -332,12 +339,16 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 #    elif defined(IS31FL3741)
 static void flush(void) {
     is31fl3741_update_pwm_buffers(DRIVER_ADDR_1, 0);
+    is31fl3741_update_global_current(DRIVER_ADDR_1, 0);
 #        if defined(DRIVER_ADDR_2)
     is31fl3741_update_pwm_buffers(DRIVER_ADDR_2, 1);
+    is31fl3741_update_global_current(DRIVER_ADDR_2, 1);
 #            if defined(DRIVER_ADDR_3)
     is31fl3741_update_pwm_buffers(DRIVER_ADDR_3, 2);
+    is31fl3741_update_global_current(DRIVER_ADDR_3, 2);
 #                if defined(DRIVER_ADDR_4)
     is31fl3741_update_pwm_buffers(DRIVER_ADDR_4, 3);
+    is31fl3741_update_global_current(DRIVER_ADDR_4, 3);
 #                endif
 #            endif
 #        endif
@@ -348,6 +359,9 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush = flush,
     .set_color = is31fl3741_set_color,
     .set_color_all = is31fl3741_set_color_all,
+#        ifdef RGB_MATRIX_HW_BREATHING
+    .set_global_brightness = is31fl3741_set_global_current,
+#        endif
 };
 
 #    elif defined(IS31FLCOMMON)
@@ -407,8 +421,10 @@ static void init(void) {
 
 static void flush(void) {
     aw20216_update_pwm_buffers(DRIVER_1_CS, 0);
+    aw20216_update_global_current(DRIVER_1_CS, 0);
 #    if defined(DRIVER_2_CS)
     aw20216_update_pwm_buffers(DRIVER_2_CS, 1);
+    aw20216_update_global_current(DRIVER_2_CS, 1);
 #    endif
 }
 
@@ -417,6 +433,9 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = flush,
     .set_color     = aw20216_set_color,
     .set_color_all = aw20216_set_color_all,
+#    ifdef RGB_MATRIX_HW_BREATHING
+    .set_global_brightness = aw20216_set_global_current,
+#    endif
 };
 
 #elif defined(WS2812)
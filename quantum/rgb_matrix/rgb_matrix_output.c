@@ -0,0 +1,118 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+#include <string.h>
+#include <lib/lib8tion/lib8tion.h>
+
+#ifdef RGB_MATRIX_OUTPUT_STAGE
+
+/* Final stage before the driver. Colors are gamma corrected per channel as
+ * they are set, and the sum of all channels is kept up to date from the
+ * change of each write, so estimating the current draw of a frame does not
+ * need to walk every LED. When the estimate exceeds the configured limit the
+ * whole frame is dimmed by the same factor, and all LEDs are resent only when
+ * that factor changes.
+ */
+
+static RGB      rgb_output[RGB_MATRIX_LED_COUNT];
+static uint8_t  rgb_output_dirty[(RGB_MATRIX_LED_COUNT + 7) / 8];
+static bool     rgb_output_any_dirty;
+static uint8_t  rgb_output_scale = UINT8_MAX;
+#    ifdef RGB_MATRIX_CURRENT_LIMIT_MA
+static uint32_t rgb_output_total; // sum of every channel of every LED on this half
+#    endif
+
+static inline void rgb_output_mark_all_dirty(void) {
+    memset(rgb_output_dirty, 0xFF, sizeof(rgb_output_dirty));
+    rgb_output_any_dirty = true;
+}
+
+#    ifdef RGB_MATRIX_CURRENT_LIMIT_MA
+// Each half of a split keyboard powers only its own LEDs, but both are handed
+// every color, so only the local range counts towards the estimate
+static inline bool rgb_output_is_local(uint8_t index) {
+#        if defined(RGB_MATRIX_SPLIT)
+    const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
+    return is_keyboard_left() == (index < k_rgb_matrix_split[0]);
+#        else
+    return true;
+#        endif
+}
+#    endif
+
+void rgb_matrix_output_init(void) {
+    memset(rgb_output, 0, sizeof(rgb_output));
+    rgb_output_scale = UINT8_MAX;
+#    ifdef RGB_MATRIX_CURRENT_LIMIT_MA
+    rgb_output_total = 0;
+#    endif
+    rgb_output_mark_all_dirty();
+}
+
+void rgb_matrix_output_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    if (index < 0 || index >= RGB_MATRIX_LED_COUNT) return;
+
+#    ifdef RGB_MATRIX_GAMMA_LUT
+    red   = pgm_read_byte(&rgb_matrix_gamma_lut[0][red]);
+    green = pgm_read_byte(&rgb_matrix_gamma_lut[1][green]);
+    blue  = pgm_read_byte(&rgb_matrix_gamma_lut[2][blue]);
+#    endif
+
+    RGB *led = &rgb_output[index];
+    if (led->r == red && led->g == green && led->b == blue) return;
+
+#    ifdef RGB_MATRIX_CURRENT_LIMIT_MA
+    if (rgb_output_is_local(index)) {
+        rgb_output_total -= led->r + led->g + led->b;
+        rgb_output_total += red + green + blue;
+    }
+#    endif
+
+    led->r = red;
+    led->g = green;
+    led->b = blue;
+    rgb_output_dirty[index / 8] |= 1 << (index % 8);
+    rgb_output_any_dirty = true;
+}
+
+static uint8_t rgb_output_calculate_scale(void) {
+#    ifdef RGB_MATRIX_CURRENT_LIMIT_MA
+    uint32_t estimate_ma = (rgb_output_total * RGB_MATRIX_LED_CURRENT_MA) / UINT8_MAX;
+    if (estimate_ma > RGB_MATRIX_CURRENT_LIMIT_MA) {
+        return ((uint32_t)RGB_MATRIX_CURRENT_LIMIT_MA * UINT8_MAX) / estimate_ma;
+    }
+#    endif
+    return UINT8_MAX;
+}
+
+uint8_t rgb_matrix_output_get_scale(void) {
+    return rgb_output_scale;
+}
+
+void rgb_matrix_output_flush(void) {
+    uint8_t scale = rgb_output_calculate_scale();
+    if (scale != rgb_output_scale) {
+        rgb_output_scale = scale;
+        rgb_output_mark_all_dirty();
+    }
+
+    if (!rgb_output_any_dirty) return;
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        if (!(rgb_output_dirty[i / 8] & (1 << (i % 8)))) continue;
+
+        RGB rgb = rgb_output[i];
+        if (scale != UINT8_MAX) {
+            rgb.r = scale8(rgb.r, scale);
+            rgb.g = scale8(rgb.g, scale);
+            rgb.b = scale8(rgb.b, scale);
+        }
+        rgb_matrix_driver.set_color(i, rgb.r, rgb.g, rgb.b);
+    }
+
+    memset(rgb_output_dirty, 0, sizeof(rgb_output_dirty));
+    rgb_output_any_dirty = false;
+}
+
+#endif // RGB_MATRIX_OUTPUT_STAGE
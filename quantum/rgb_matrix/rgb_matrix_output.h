@@ -0,0 +1,30 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "progmem.h"
+
+#if defined(RGB_MATRIX_GAMMA_LUT) || defined(RGB_MATRIX_CURRENT_LIMIT_MA)
+#    define RGB_MATRIX_OUTPUT_STAGE
+#endif
+
+#ifdef RGB_MATRIX_OUTPUT_STAGE
+
+#    if defined(RGB_MATRIX_CURRENT_LIMIT_MA) && !defined(RGB_MATRIX_LED_CURRENT_MA)
+// Current drawn by a single channel at full brightness, 20mA matches WS2812-style LEDs
+#        define RGB_MATRIX_LED_CURRENT_MA 20
+#    endif
+
+#    ifdef RGB_MATRIX_GAMMA_LUT
+// Provided by the keyboard, indexed as [channel][value] with channels in red, green, blue order
+extern const uint8_t rgb_matrix_gamma_lut[3][256] PROGMEM;
+#    endif
+
+void    rgb_matrix_output_init(void);
+void    rgb_matrix_output_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
+void    rgb_matrix_output_flush(void);
+uint8_t rgb_matrix_output_get_scale(void);
+
+#endif // RGB_MATRIX_OUTPUT_STAGE
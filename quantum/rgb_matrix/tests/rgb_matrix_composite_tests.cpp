@@ -0,0 +1,170 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "effect_bench.h"
+
+extern uint16_t mock_set_color_calls;
+void            rgb_matrix_update_pwm_buffers(void);
+}
+
+static const effect_bench_target_t target = {
+    .mode  = rgb_matrix_mode_noeeprom,
+    .task  = rgb_matrix_task,
+    .press = process_rgb_matrix,
+    .rows  = MATRIX_ROWS,
+    .cols  = MATRIX_COLS,
+};
+
+class RgbMatrixComposite : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        rgb_matrix_init();
+        for (uint8_t layer = 0; layer < RGB_MATRIX_OVERLAY_LAYERS; layer++) {
+            rgb_matrix_overlay_set_blend_mode(layer, RGB_MATRIX_BLEND_NORMAL);
+        }
+        rgb_matrix_composite_show_overlays(true);
+        flush();
+    }
+
+    // Flushes and returns how many LEDs were handed to the driver
+    uint16_t flush(void) {
+        mock_set_color_calls = 0;
+        rgb_matrix_update_pwm_buffers();
+        return mock_set_color_calls;
+    }
+
+    // The blends use 8-bit fixed point, which can be off by a little from the exact result
+    void expect_led(uint8_t index, uint8_t r, uint8_t g, uint8_t b) {
+        const uint8_t *frame = effect_bench_last_frame(NULL);
+        EXPECT_NEAR(frame[index * 3 + 0], r, 2) << "led " << (int)index;
+        EXPECT_NEAR(frame[index * 3 + 1], g, 2) << "led " << (int)index;
+        EXPECT_NEAR(frame[index * 3 + 2], b, 2) << "led " << (int)index;
+    }
+};
+
+TEST_F(RgbMatrixComposite, BaseWithoutOverlaysPassesThrough) {
+    rgb_matrix_set_color(3, 10, 20, 30);
+    flush();
+    expect_led(3, 10, 20, 30);
+}
+
+TEST_F(RgbMatrixComposite, NormalMixesByAlpha) {
+    rgb_matrix_set_color(0, 200, 100, 0);
+    rgb_matrix_overlay_set_color(0, 0, 0, 0, 255, 128);
+    flush();
+    // below * (255 - alpha) / 255 + above * alpha / 255
+    expect_led(0, 100, 50, 128);
+
+    rgb_matrix_overlay_set_color(0, 0, 0, 0, 255, 255);
+    flush();
+    expect_led(0, 0, 0, 255);
+}
+
+TEST_F(RgbMatrixComposite, AddSaturates) {
+    rgb_matrix_overlay_set_blend_mode(0, RGB_MATRIX_BLEND_ADD);
+    rgb_matrix_set_color(1, 200, 100, 0);
+    rgb_matrix_overlay_set_color(0, 1, 100, 100, 100, 128);
+    flush();
+    expect_led(1, 250, 150, 50);
+
+    rgb_matrix_overlay_set_color(0, 1, 100, 100, 100, 255);
+    flush();
+    expect_led(1, 255, 200, 100);
+}
+
+TEST_F(RgbMatrixComposite, MultiplyDarkens) {
+    rgb_matrix_overlay_set_blend_mode(0, RGB_MATRIX_BLEND_MULTIPLY);
+    rgb_matrix_set_color(2, 200, 100, 255);
+    rgb_matrix_overlay_set_color(0, 2, 128, 255, 0, 255);
+    flush();
+    expect_led(2, 100, 100, 0);
+
+    // Half strength moves half way towards the product
+    rgb_matrix_overlay_set_color(0, 2, 128, 255, 0, 128);
+    flush();
+    expect_led(2, 150, 100, 128);
+}
+
+TEST_F(RgbMatrixComposite, HigherLayersDrawOverLowerOnes) {
+    rgb_matrix_set_color(4, 10, 10, 10);
+    rgb_matrix_overlay_set_color(0, 4, 255, 0, 0, 255);
+    rgb_matrix_overlay_set_color(1, 4, 0, 255, 0, 255);
+    flush();
+    expect_led(4, 0, 255, 0);
+
+    // A transparent top layer shows the one below
+    rgb_matrix_overlay_set_color(1, 4, 0, 255, 0, 0);
+    flush();
+    expect_led(4, 255, 0, 0);
+
+    rgb_matrix_composite_show_overlays(false);
+    flush();
+    expect_led(4, 10, 10, 10);
+}
+
+TEST_F(RgbMatrixComposite, OnlyChangedLedsReachTheDriver) {
+    EXPECT_EQ(flush(), 0);
+
+    rgb_matrix_set_color(5, 1, 2, 3);
+    rgb_matrix_overlay_set_color(1, 7, 1, 2, 3, 255);
+    EXPECT_EQ(flush(), 2);
+
+    // Writing what is already there changes nothing
+    rgb_matrix_set_color(5, 1, 2, 3);
+    rgb_matrix_overlay_set_color(1, 7, 1, 2, 3, 255);
+    rgb_matrix_overlay_set_color(0, 9, 50, 50, 50, 0);
+    EXPECT_EQ(flush(), 0);
+
+    // Changing how a layer blends affects every LED
+    rgb_matrix_overlay_set_blend_mode(0, RGB_MATRIX_BLEND_ADD);
+    EXPECT_EQ(flush(), RGB_MATRIX_LED_COUNT);
+}
+
+TEST_F(RgbMatrixComposite, BeginRedirectsSetColorToAnOverlay) {
+    rgb_matrix_set_color_all(10, 10, 10);
+
+    rgb_matrix_overlay_begin(1, 255);
+    rgb_matrix_set_color(6, 0, 0, 200);
+    rgb_matrix_overlay_end();
+    rgb_matrix_set_color(8, 20, 20, 20);
+    flush();
+    expect_led(6, 0, 0, 200);
+    expect_led(8, 20, 20, 20);
+
+    // The base under the overlay was left alone
+    rgb_matrix_overlay_clear(1);
+    flush();
+    expect_led(6, 10, 10, 10);
+
+    // Fills go to the overlay at the given alpha
+    rgb_matrix_overlay_begin(0, 128);
+    rgb_matrix_set_color_all(210, 210, 210);
+    rgb_matrix_overlay_end();
+    flush();
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        expect_led(i, i == 8 ? 115 : 110, i == 8 ? 115 : 110, i == 8 ? 115 : 110);
+    }
+}
+
+TEST_F(RgbMatrixComposite, EffectsAlwaysDrawOnTheBase) {
+    effect_bench_result_t result;
+    rgb_matrix_enable_noeeprom();
+    rgb_matrix_sethsv_noeeprom(85, 255, 100);
+
+    // A target left open by user code is closed before the effect renders
+    rgb_matrix_overlay_begin(0, 255);
+    effect_bench_run(&target, RGB_MATRIX_SOLID_COLOR, 3, 1, 0, &result);
+    ASSERT_EQ(result.frames, 3);
+
+    RGB expected = hsv_to_rgb((HSV){85, 255, 100});
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        expect_led(i, expected.r, expected.g, expected.b);
+    }
+    rgb_matrix_overlay_clear(0);
+    flush();
+    expect_led(0, expected.r, expected.g, expected.b);
+}
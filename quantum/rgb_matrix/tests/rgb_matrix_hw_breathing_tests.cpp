@@ -0,0 +1,68 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include <algorithm>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "effect_bench.h"
+
+extern uint8_t mock_global_brightness;
+}
+
+#define TICK_MS 1
+
+static const effect_bench_target_t target = {
+    .mode  = rgb_matrix_mode_noeeprom,
+    .task  = rgb_matrix_task,
+    .press = NULL,
+    .rows  = MATRIX_ROWS,
+    .cols  = MATRIX_COLS,
+};
+
+class RgbMatrixHwBreathing : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(170, 255, 200);
+        rgb_matrix_set_speed_noeeprom(255);
+    }
+};
+
+TEST_F(RgbMatrixHwBreathing, FrameStaysAtFullValue) {
+    effect_bench_result_t result;
+    size_t                size;
+    uint8_t               first[RGB_MATRIX_LED_COUNT * 3];
+
+    effect_bench_run(&target, RGB_MATRIX_BREATHING, 2, TICK_MS, 0, &result);
+    memcpy(first, effect_bench_last_frame(&size), sizeof(first));
+    ASSERT_EQ(size, sizeof(first));
+
+    // scale8(UINT8_MAX, 200) loses one step, as it always has at the top of the breath
+    RGB expected = hsv_to_rgb((HSV){170, 255, 199});
+    EXPECT_EQ(first[0], expected.r);
+    EXPECT_EQ(first[1], expected.g);
+    EXPECT_EQ(first[2], expected.b);
+
+    uint8_t lowest = UINT8_MAX, highest = 0;
+    for (int i = 0; i < 50; i++) {
+        effect_bench_run(&target, RGB_MATRIX_BREATHING, 1, TICK_MS, 0, &result);
+        EXPECT_EQ(memcmp(first, effect_bench_last_frame(NULL), sizeof(first)), 0) << "frame " << i;
+        lowest  = std::min(lowest, mock_global_brightness);
+        highest = std::max(highest, mock_global_brightness);
+    }
+    // The breathing is carried by the driver instead
+    EXPECT_LT(lowest, highest);
+}
+
+TEST_F(RgbMatrixHwBreathing, OtherEffectsGetFullBrightnessBack) {
+    effect_bench_result_t result;
+    effect_bench_run(&target, RGB_MATRIX_BREATHING, 20, TICK_MS, 0, &result);
+    ASSERT_NE(mock_global_brightness, UINT8_MAX);
+
+    effect_bench_run(&target, RGB_MATRIX_SOLID_COLOR, 2, TICK_MS, 0, &result);
+    EXPECT_EQ(mock_global_brightness, UINT8_MAX);
+}
@@ -0,0 +1,170 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "effect_bench.h"
+
+extern uint16_t mock_set_color_calls;
+void            rgb_matrix_update_pwm_buffers(void);
+
+#define LUT_4(f, n) f(n), f(n + 1), f(n + 2), f(n + 3)
+#define LUT_16(f, n) LUT_4(f, n), LUT_4(f, n + 4), LUT_4(f, n + 8), LUT_4(f, n + 12)
+#define LUT_64(f, n) LUT_16(f, n), LUT_16(f, n + 16), LUT_16(f, n + 32), LUT_16(f, n + 48)
+#define LUT_256(f) LUT_64(f, 0), LUT_64(f, 64), LUT_64(f, 128), LUT_64(f, 192)
+#define LUT_RED(i) (i)
+#define LUT_GREEN(i) ((i) / 2)
+#define LUT_BLUE(i) ((i)*3 / 4)
+
+// A different curve per channel, so each one can be told apart
+const uint8_t rgb_matrix_gamma_lut[3][256] PROGMEM = {
+    {LUT_256(LUT_RED)},
+    {LUT_256(LUT_GREEN)},
+    {LUT_256(LUT_BLUE)},
+};
+
+#ifdef RGB_MATRIX_SPLIT
+static bool mock_is_left = true;
+
+bool is_keyboard_left(void) {
+    return mock_is_left;
+}
+#endif
+}
+
+// Sum of the corrected channels of a grey LED
+static uint32_t corrected_sum(uint8_t v) {
+    return LUT_RED(v) + LUT_GREEN(v) + LUT_BLUE(v);
+}
+
+// The frame scale for a sum of every channel, worked out in floating point
+static uint8_t expected_scale(uint32_t total) {
+    double estimate_ma = (double)total * RGB_MATRIX_LED_CURRENT_MA / 255;
+    if (estimate_ma <= RGB_MATRIX_CURRENT_LIMIT_MA) {
+        return 255;
+    }
+    return RGB_MATRIX_CURRENT_LIMIT_MA * 255 / estimate_ma;
+}
+
+class RgbMatrixOutput : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        rgb_matrix_init();
+        flush();
+    }
+
+    // Flushes and returns how many LEDs were handed to the driver
+    uint16_t flush(void) {
+        mock_set_color_calls = 0;
+        rgb_matrix_update_pwm_buffers();
+        return mock_set_color_calls;
+    }
+
+    void expect_led(uint8_t index, uint8_t r, uint8_t g, uint8_t b) {
+        const uint8_t *frame = effect_bench_last_frame(NULL);
+        EXPECT_NEAR(frame[index * 3 + 0], r, 1) << "led " << (int)index;
+        EXPECT_NEAR(frame[index * 3 + 1], g, 1) << "led " << (int)index;
+        EXPECT_NEAR(frame[index * 3 + 2], b, 1) << "led " << (int)index;
+    }
+};
+
+TEST_F(RgbMatrixOutput, CorrectsEachChannel) {
+    rgb_matrix_set_color(0, 100, 100, 100);
+    rgb_matrix_set_color(1, 255, 0, 40);
+    flush();
+    expect_led(0, 100, 50, 75);
+    expect_led(1, 255, 0, 30);
+}
+
+#ifndef RGB_MATRIX_SPLIT
+TEST_F(RgbMatrixOutput, UnderTheLimitIsNotScaled) {
+    rgb_matrix_set_color(2, 255, 255, 255);
+    flush();
+
+    EXPECT_EQ(rgb_matrix_output_get_scale(), 255);
+    expect_led(2, 255, 127, 191);
+}
+
+TEST_F(RgbMatrixOutput, OverTheLimitScalesTheWholeFrame) {
+    rgb_matrix_set_color_all(255, 255, 255);
+    flush();
+
+    uint8_t scale = expected_scale(RGB_MATRIX_LED_COUNT * corrected_sum(255));
+    ASSERT_LT(scale, 255);
+    EXPECT_NEAR(rgb_matrix_output_get_scale(), scale, 1);
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        expect_led(i, 255 * scale / 255, 127 * scale / 255, 191 * scale / 255);
+    }
+
+    // What reaches the LEDs now fits the budget
+    const uint8_t *frame = effect_bench_last_frame(NULL);
+    uint32_t       total = 0;
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT * 3; i++) {
+        total += frame[i];
+    }
+    EXPECT_LE(total * RGB_MATRIX_LED_CURRENT_MA / 255, RGB_MATRIX_CURRENT_LIMIT_MA);
+
+    // Turning the LEDs off again lifts the limit
+    rgb_matrix_set_color_all(0, 0, 0);
+    flush();
+    EXPECT_EQ(rgb_matrix_output_get_scale(), 255);
+}
+
+TEST_F(RgbMatrixOutput, EstimateFollowsEveryChange) {
+    rgb_matrix_set_color_all(255, 255, 255);
+    rgb_matrix_set_color(0, 10, 20, 30);
+    rgb_matrix_set_color(0, 0, 0, 0);
+    rgb_matrix_set_color(1, 128, 0, 0);
+    flush();
+
+    uint32_t total = (RGB_MATRIX_LED_COUNT - 2) * corrected_sum(255) + 128;
+    EXPECT_NEAR(rgb_matrix_output_get_scale(), expected_scale(total), 1);
+}
+
+TEST_F(RgbMatrixOutput, OnlyChangesAreResentWhileTheScaleHolds) {
+    EXPECT_EQ(flush(), 0);
+
+    rgb_matrix_set_color(3, 50, 50, 50);
+    EXPECT_EQ(flush(), 1);
+    rgb_matrix_set_color(3, 50, 50, 50);
+    EXPECT_EQ(flush(), 0);
+
+    // A new scale changes every LED
+    rgb_matrix_set_color_all(255, 255, 255);
+    EXPECT_EQ(flush(), RGB_MATRIX_LED_COUNT);
+    uint8_t scale = rgb_matrix_output_get_scale();
+    rgb_matrix_set_color(0, 0, 0, 0);
+    EXPECT_EQ(flush(), RGB_MATRIX_LED_COUNT);
+    EXPECT_GT(rgb_matrix_output_get_scale(), scale);
+}
+#else
+TEST_F(RgbMatrixOutput, EachHalfOnlyCountsItsOwnLeds) {
+    const uint8_t split[2] = RGB_MATRIX_SPLIT;
+    for (uint8_t left = 0; left < 2; left++) {
+        mock_is_left = left;
+        rgb_matrix_init();
+        rgb_matrix_set_color_all(255, 255, 255);
+        flush();
+
+        uint8_t local = left ? split[0] : split[1];
+        EXPECT_NEAR(rgb_matrix_output_get_scale(), expected_scale(local * corrected_sum(255)), 1) << (left ? "left" : "right");
+    }
+}
+
+TEST_F(RgbMatrixOutput, TheOtherHalfDoesNotCount) {
+    const uint8_t split[2] = RGB_MATRIX_SPLIT;
+    for (uint8_t left = 0; left < 2; left++) {
+        mock_is_left = left;
+        rgb_matrix_init();
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            if ((i < split[0]) != (bool)left) {
+                rgb_matrix_set_color(i, 255, 255, 255);
+            }
+        }
+        flush();
+        EXPECT_EQ(rgb_matrix_output_get_scale(), 255) << (left ? "left" : "right");
+    }
+}
+#endif
@@ -0,0 +1,122 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "effect_bench.h"
+}
+
+#define TICK_MS 1
+#define MAX_CHUNKS 256
+
+static const effect_bench_target_t target = {
+    .mode  = rgb_matrix_mode_noeeprom,
+    .task  = rgb_matrix_task,
+    .press = process_rgb_matrix,
+    .rows  = MATRIX_ROWS,
+    .cols  = MATRIX_COLS,
+};
+
+typedef struct {
+    uint8_t  led_min;
+    uint8_t  led_count;
+    uint32_t elapsed_us;
+} chunk_t;
+
+// Render time is faked: each chunk takes its LED count times the chosen per LED cost
+static uint32_t fake_led_cost_ns;
+static uint32_t fake_now_us;
+static bool     fake_in_chunk;
+static chunk_t  chunks[MAX_CHUNKS];
+static uint16_t chunk_count;
+
+extern "C" uint32_t rgb_matrix_render_timer_us(void) {
+    // Calls alternate between the start and the end of a chunk
+    fake_in_chunk = !fake_in_chunk;
+    if (fake_in_chunk) {
+        if (chunk_count < MAX_CHUNKS) {
+            chunks[chunk_count].led_min   = g_rgb_render_led_min;
+            chunks[chunk_count].led_count = g_rgb_render_led_count;
+        }
+        return fake_now_us;
+    }
+
+    uint8_t leds = RGB_MATRIX_LED_COUNT - g_rgb_render_led_min;
+    if (leds > g_rgb_render_led_count) leds = g_rgb_render_led_count;
+    uint32_t elapsed = fake_led_cost_ns * leds / 1000;
+    if (chunk_count < MAX_CHUNKS) {
+        chunks[chunk_count++].elapsed_us = elapsed;
+    }
+    fake_now_us += elapsed;
+    return fake_now_us;
+}
+
+class RgbMatrixRenderBudget : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, UINT8_MAX);
+        chunk_count = 0;
+    }
+
+    void run(uint32_t led_cost_ns, uint32_t frames) {
+        effect_bench_result_t result;
+        fake_led_cost_ns = led_cost_ns;
+        effect_bench_run(&target, RGB_MATRIX_SOLID_COLOR, frames, TICK_MS, 0, &result);
+        ASSERT_EQ(result.frames, frames);
+    }
+};
+
+TEST_F(RgbMatrixRenderBudget, FirstSampleSeedsTheEstimate) {
+    run(10000, 1);
+
+    ASSERT_GE(chunk_count, 2);
+    // Nothing measured after init, then straight to the measured cost rather than averaging up from zero
+    EXPECT_EQ(chunks[0].led_count, RGB_MATRIX_LED_PROCESS_LIMIT);
+    EXPECT_EQ(chunks[1].led_count, RGB_MATRIX_RENDER_BUDGET_US / 10);
+}
+
+TEST_F(RgbMatrixRenderBudget, ChunksConvergeOnTheBudget) {
+    const uint32_t costs_ns[] = {10000, 25000, 7000, 40000};
+    for (uint8_t i = 0; i < sizeof(costs_ns) / sizeof(costs_ns[0]); i++) {
+        run(costs_ns[i], 30);
+        chunk_count = 0;
+        run(costs_ns[i], 2);
+
+        uint32_t expected = RGB_MATRIX_RENDER_BUDGET_US * 1000 / costs_ns[i];
+        for (uint16_t c = 0; c < chunk_count; c++) {
+            EXPECT_NEAR(chunks[c].led_count, expected, 1) << "cost " << costs_ns[i] << "ns";
+            EXPECT_LE(chunks[c].elapsed_us, RGB_MATRIX_RENDER_BUDGET_US * 11 / 10) << "cost " << costs_ns[i] << "ns";
+        }
+    }
+}
+
+TEST_F(RgbMatrixRenderBudget, ZeroLengthChunksDoNotStallTheEstimate) {
+    // A timer too coarse to see the render measures nothing, which counts as the cheapest possible cost
+    run(0, 3);
+
+    ASSERT_GE(chunk_count, 3);
+    for (uint16_t c = 1; c < chunk_count; c++) {
+        EXPECT_EQ(chunks[c].led_count, RGB_MATRIX_LED_COUNT) << "chunk " << c;
+    }
+}
+
+TEST_F(RgbMatrixRenderBudget, EveryFrameStartsFromTheFirstLed) {
+    run(10000, 5);
+    chunk_count = 0;
+    run(10000, 4);
+
+    // Chunks tile each frame from LED 0, restarting when a new frame begins
+    uint8_t next = 0;
+    for (uint16_t c = 0; c < chunk_count; c++) {
+        if (chunks[c].led_min == 0) {
+            EXPECT_TRUE(c == 0 || next >= RGB_MATRIX_LED_COUNT) << "chunk " << c;
+        } else {
+            EXPECT_EQ(chunks[c].led_min, next) << "chunk " << c;
+        }
+        next = chunks[c].led_min + chunks[c].led_count;
+    }
+}
@@ -0,0 +1,63 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "effect_bench.h"
+}
+
+#define FRAMES 200
+#define TICK_MS 1
+#define PRESS_INTERVAL_MS 150
+
+static const effect_bench_target_t target = {
+    .mode  = rgb_matrix_mode_noeeprom,
+    .task  = rgb_matrix_task,
+    .press = process_rgb_matrix,
+    .rows  = MATRIX_ROWS,
+    .cols  = MATRIX_COLS,
+};
+
+class RgbMatrix : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, UINT8_MAX);
+    }
+};
+
+TEST_F(RgbMatrix, EveryEffectRenders) {
+    effect_bench_print_header("rgb_matrix");
+    for (uint8_t mode = RGB_MATRIX_SOLID_COLOR; mode < RGB_MATRIX_EFFECT_MAX; mode++) {
+        effect_bench_result_t result;
+        effect_bench_run(&target, mode, FRAMES, TICK_MS, PRESS_INTERVAL_MS, &result);
+        effect_bench_print("rgb_matrix", &result);
+        EXPECT_EQ(result.frames, FRAMES) << "mode " << (int)mode;
+    }
+}
+
+TEST_F(RgbMatrix, FlushesAtTheConfiguredRate) {
+    effect_bench_result_t result;
+    effect_bench_run(&target, RGB_MATRIX_SOLID_COLOR, 10, TICK_MS, 0, &result);
+    // A frame is rendered over several passes, then held until the flush interval has passed
+    EXPECT_GE(result.task_calls, 10 * RGB_MATRIX_LED_FLUSH_LIMIT / TICK_MS - RGB_MATRIX_LED_FLUSH_LIMIT);
+}
+
+TEST_F(RgbMatrix, SolidColorFillsEveryLed) {
+    effect_bench_result_t result;
+    rgb_matrix_sethsv_noeeprom(85, 255, 100);
+    effect_bench_run(&target, RGB_MATRIX_SOLID_COLOR, 3, TICK_MS, 0, &result);
+
+    RGB            expected = hsv_to_rgb((HSV){85, 255, 100});
+    size_t         size;
+    const uint8_t *frame = effect_bench_last_frame(&size);
+    ASSERT_EQ(size, RGB_MATRIX_LED_COUNT * 3);
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        EXPECT_EQ(frame[i * 3 + 0], expected.r) << "led " << (int)i;
+        EXPECT_EQ(frame[i * 3 + 1], expected.g) << "led " << (int)i;
+        EXPECT_EQ(frame[i * 3 + 2], expected.b) << "led " << (int)i;
+    }
+}
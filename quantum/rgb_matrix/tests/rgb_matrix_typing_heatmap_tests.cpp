@@ -0,0 +1,55 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "rgb_matrix.h"
+}
+
+// LED 0 is also wired to the bottom right key, sharing the top left key's position
+#define TWIN_ROW (MATRIX_ROWS - 1)
+#define TWIN_COL (MATRIX_COLS - 1)
+
+// The effect's defaults, with every neighbor in reach close enough to get the full area limit
+#define STEP 32
+#define AREA 16
+
+class RgbMatrixTypingHeatmap : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        twin_led                                   = g_led_config.matrix_co[TWIN_ROW][TWIN_COL];
+        g_led_config.matrix_co[TWIN_ROW][TWIN_COL] = 0;
+        rgb_matrix_init();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_TYPING_HEATMAP);
+        memset(g_rgb_frame_buffer, 0, sizeof g_rgb_frame_buffer);
+    }
+
+    void TearDown() override {
+        g_led_config.matrix_co[TWIN_ROW][TWIN_COL] = twin_led;
+    }
+
+    uint8_t twin_led;
+};
+
+TEST_F(RgbMatrixTypingHeatmap, PressedKeyOnlyGetsTheStep) {
+    process_rgb_matrix(1, 2, true);
+
+    EXPECT_EQ(g_rgb_frame_buffer[1][2], STEP);
+    EXPECT_EQ(g_rgb_frame_buffer[2][2], AREA);
+    EXPECT_EQ(g_rgb_frame_buffer[0][2], AREA);
+    EXPECT_EQ(g_rgb_frame_buffer[1][1], 0);
+    EXPECT_EQ(g_rgb_frame_buffer[3][2], 0);
+}
+
+TEST_F(RgbMatrixTypingHeatmap, OtherKeysOfTheSameLedAreHeated) {
+    process_rgb_matrix(0, 0, true);
+    EXPECT_EQ(g_rgb_frame_buffer[0][0], STEP);
+    EXPECT_EQ(g_rgb_frame_buffer[TWIN_ROW][TWIN_COL], AREA);
+
+    process_rgb_matrix(TWIN_ROW, TWIN_COL, true);
+    EXPECT_EQ(g_rgb_frame_buffer[0][0], STEP + AREA);
+    EXPECT_EQ(g_rgb_frame_buffer[TWIN_ROW][TWIN_COL], AREA + STEP);
+    EXPECT_EQ(g_rgb_frame_buffer[1][0], 2 * AREA);
+}
@@ -0,0 +1,71 @@
+rgb_matrix_DEFS := -DRGB_MATRIX_ENABLE -DEEPROM_TEST_HARNESS -DNO_PRINT -DNO_DEBUG
+rgb_matrix_CONFIG := $(QUANTUM_PATH)/rgb_matrix/tests/config_mock.h
+
+rgb_matrix_INC := \
+	$(QUANTUM_PATH)/rgb_matrix \
+	$(QUANTUM_PATH)/rgb_matrix/animations \
+	$(QUANTUM_PATH)/rgb_matrix/animations/runners \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)
+
+rgb_matrix_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/effect_bench.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/mock.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_tests.cpp \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix_composite.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix_output.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix_drivers.c \
+	$(QUANTUM_PATH)/color.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c
+
+rgb_matrix_hw_breathing_DEFS := $(rgb_matrix_DEFS) -DRGB_MATRIX_HW_BREATHING
+rgb_matrix_hw_breathing_CONFIG := $(rgb_matrix_CONFIG)
+rgb_matrix_hw_breathing_INC := $(rgb_matrix_INC)
+
+rgb_matrix_hw_breathing_SRC := \
+	$(filter-out %/rgb_matrix_tests.cpp,$(rgb_matrix_SRC)) \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_hw_breathing_tests.cpp
+
+rgb_matrix_render_budget_DEFS := $(rgb_matrix_DEFS) -DRGB_MATRIX_RENDER_BUDGET_US=100
+rgb_matrix_render_budget_CONFIG := $(rgb_matrix_CONFIG)
+rgb_matrix_render_budget_INC := $(rgb_matrix_INC)
+
+rgb_matrix_render_budget_SRC := \
+	$(filter-out %/rgb_matrix_tests.cpp,$(rgb_matrix_SRC)) \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_render_budget_tests.cpp
+
+rgb_matrix_composite_DEFS := $(rgb_matrix_DEFS) -DRGB_MATRIX_OVERLAY_LAYERS=2
+rgb_matrix_composite_CONFIG := $(rgb_matrix_CONFIG)
+rgb_matrix_composite_INC := $(rgb_matrix_INC)
+
+rgb_matrix_composite_SRC := \
+	$(filter-out %/rgb_matrix_tests.cpp,$(rgb_matrix_SRC)) \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_composite_tests.cpp
+
+rgb_matrix_output_DEFS := $(rgb_matrix_DEFS) -DRGB_MATRIX_GAMMA_LUT -DRGB_MATRIX_CURRENT_LIMIT_MA=400
+rgb_matrix_output_CONFIG := $(rgb_matrix_CONFIG)
+rgb_matrix_output_INC := $(rgb_matrix_INC)
+
+rgb_matrix_output_SRC := \
+	$(filter-out %/rgb_matrix_tests.cpp,$(rgb_matrix_SRC)) \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_output_tests.cpp
+
+rgb_matrix_output_split_DEFS := $(rgb_matrix_output_DEFS) '-DRGB_MATRIX_SPLIT={12, 12}'
+rgb_matrix_output_split_CONFIG := $(rgb_matrix_CONFIG)
+rgb_matrix_output_split_INC := $(rgb_matrix_INC)
+rgb_matrix_output_split_SRC := $(rgb_matrix_output_SRC)
+
+rgb_matrix_typing_heatmap_DEFS := $(rgb_matrix_DEFS)
+rgb_matrix_typing_heatmap_CONFIG := $(rgb_matrix_CONFIG)
+rgb_matrix_typing_heatmap_INC := $(rgb_matrix_INC)
+
+rgb_matrix_typing_heatmap_SRC := \
+	$(filter-out %/rgb_matrix_tests.cpp,$(rgb_matrix_SRC)) \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_typing_heatmap_tests.cpp
+
+rgb_matrix_typing_heatmap_cache_DEFS := $(rgb_matrix_DEFS) -DRGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_CACHE_SIZE=64
+rgb_matrix_typing_heatmap_cache_CONFIG := $(rgb_matrix_CONFIG)
+rgb_matrix_typing_heatmap_cache_INC := $(rgb_matrix_INC)
+rgb_matrix_typing_heatmap_cache_SRC := $(rgb_matrix_typing_heatmap_SRC)
@@ -0,0 +1,8 @@
+TEST_LIST += rgb_matrix
+TEST_LIST += rgb_matrix_hw_breathing
+TEST_LIST += rgb_matrix_render_budget
+TEST_LIST += rgb_matrix_composite
+TEST_LIST += rgb_matrix_output
+TEST_LIST += rgb_matrix_output_split
+TEST_LIST += rgb_matrix_typing_heatmap
+TEST_LIST += rgb_matrix_typing_heatmap_cache
@@ -127,6 +127,23 @@ static bool deferred_set_layer_state = false;
 
 rgblight_ranges_t rgblight_ranges = {0, RGBLED_NUM, 0, RGBLED_NUM, RGBLED_NUM};
 
+#if defined(RGBLIGHT_EFFECT_RAINBOW_SWIRL) || defined(RGBLIGHT_EFFECT_KNIGHT)
+// Per LED values precomputed for the running effect, so each step skips the
+// divisions. Holds hue offsets for rainbow swirl and strip positions for knight,
+// and is rebuilt when the effect or the effect range changes.
+static uint8_t rgblight_phase[RGBLED_NUM];
+static uint8_t rgblight_phase_mode = 0;
+#    define RGBLIGHT_PHASE_INVALIDATE() (rgblight_phase_mode = 0)
+#else
+#    define RGBLIGHT_PHASE_INVALIDATE()
+#endif
+
+#ifdef RGBLIGHT_SKIP_UNCHANGED_FRAMES
+// Last frame handed to the driver
+static LED_TYPE rgblight_sent[RGBLED_NUM];
+static uint8_t  rgblight_sent_num = 0;
+#endif
+
 void rgblight_set_clipping_range(uint8_t start_pos, uint8_t num_leds) {
     rgblight_ranges.clipping_start_pos = start_pos;
     rgblight_ranges.clipping_num_leds  = num_leds;
@@ -138,6 +155,7 @@ void rgblight_set_effect_range(uint8_t start_pos, uint8_t num_leds) {
     rgblight_ranges.effect_start_pos = start_pos;
     rgblight_ranges.effect_end_pos   = start_pos + num_leds;
     rgblight_ranges.effect_num_leds  = num_leds;
+    RGBLIGHT_PHASE_INVALIDATE();
 }
 
 __attribute__((weak)) RGB rgblight_hsv_to_rgb(HSV hsv) {
@@ -944,6 +962,14 @@ void rgblight_set(void) {
     for (uint8_t i = 0; i < num_leds; i++) {
         convert_rgb_to_rgbw(&start_led[i]);
     }
+#    endif
+#    ifdef RGBLIGHT_SKIP_UNCHANGED_FRAMES
+    // The strip already shows this frame
+    if (num_leds == rgblight_sent_num && memcmp(rgblight_sent, start_led, num_leds * sizeof(LED_TYPE)) == 0) {
+        return;
+    }
+    memcpy(rgblight_sent, start_led, num_leds * sizeof(LED_TYPE));
+    rgblight_sent_num = num_leds;
 #    endif
     rgblight_call_driver(start_led, num_leds);
 }
@@ -1225,12 +1251,20 @@ void rgblight_effect_rainbow_mood(animation_status_t *anim) {
 __attribute__((weak)) const uint8_t RGBLED_RAINBOW_SWIRL_INTERVALS[] PROGMEM = {100, 50, 20};
 
 void rgblight_effect_rainbow_swirl(animation_status_t *anim) {
-    uint8_t hue;
-    uint8_t i;
+    uint8_t   hue;
+    uint8_t   i;
+    LED_TYPE *ledp = led + rgblight_ranges.effect_start_pos;
+
+    if (rgblight_phase_mode != RGBLIGHT_MODE_RAINBOW_SWIRL) {
+        for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
+            rgblight_phase[i] = RGBLIGHT_RAINBOW_SWIRL_RANGE / rgblight_ranges.effect_num_leds * i;
+        }
+        rgblight_phase_mode = RGBLIGHT_MODE_RAINBOW_SWIRL;
+    }
 
     for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        hue = (RGBLIGHT_RAINBOW_SWIRL_RANGE / rgblight_ranges.effect_num_leds * i + anim->current_hue);
-        sethsv(hue, rgblight_config.sat, rgblight_config.val, (LED_TYPE *)&led[i + rgblight_ranges.effect_start_pos]);
+        hue = rgblight_phase[i] + anim->current_hue;
+        sethsv(hue, rgblight_config.sat, rgblight_config.val, &ledp[i]);
     }
     rgblight_set();
 
@@ -1266,25 +1300,26 @@ void rgblight_effect_snake(animation_status_t *anim) {
     }
 #    endif
 
+    LED_TYPE *ledp = led + rgblight_ranges.effect_start_pos;
     for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        LED_TYPE *ledp = led + i + rgblight_ranges.effect_start_pos;
-        ledp->r        = 0;
-        ledp->g        = 0;
-        ledp->b        = 0;
+        ledp[i].r = 0;
+        ledp[i].g = 0;
+        ledp[i].b = 0;
 #    ifdef RGBW
-        ledp->w = 0;
+        ledp[i].w = 0;
 #    endif
-        for (j = 0; j < RGBLIGHT_EFFECT_SNAKE_LENGTH; j++) {
-            k = pos + j * increment;
-            if (k > RGBLED_NUM) {
-                k = k % (RGBLED_NUM);
-            }
-            if (k < 0) {
-                k = k + rgblight_ranges.effect_num_leds;
-            }
-            if (i == k) {
-                sethsv(rgblight_config.hue, rgblight_config.sat, (uint8_t)(rgblight_config.val * (RGBLIGHT_EFFECT_SNAKE_LENGTH - j) / RGBLIGHT_EFFECT_SNAKE_LENGTH), ledp);
-            }
+    }
+    // Only the LEDs under the snake need a colour
+    for (j = 0; j < RGBLIGHT_EFFECT_SNAKE_LENGTH; j++) {
+        k = pos + j * increment;
+        if (k > RGBLED_NUM) {
+            k = k % (RGBLED_NUM);
+        }
+        if (k < 0) {
+            k = k + rgblight_ranges.effect_num_leds;
+        }
+        if (k >= 0 && k < rgblight_ranges.effect_num_leds) {
+            sethsv(rgblight_config.hue, rgblight_config.sat, (uint8_t)(rgblight_config.val * (RGBLIGHT_EFFECT_SNAKE_LENGTH - j) / RGBLIGHT_EFFECT_SNAKE_LENGTH), &ledp[k]);
         }
     }
     rgblight_set();
@@ -1317,6 +1352,7 @@ void rgblight_effect_knight(animation_status_t *anim) {
     static int8_t high_bound = RGBLIGHT_EFFECT_KNIGHT_LENGTH - 1;
     static int8_t increment  = RGBLIGHT_EFFECT_KNIGHT_INCREMENT;
     uint8_t       i, cur;
+    LED_TYPE      lit = {0}, off = {0};
 
 #    if defined(RGBLIGHT_SPLIT) && !defined(RGBLIGHT_SPLIT_NO_ANIMATION_SYNC)
     if (anim->pos == 0) { // restart signal
@@ -1335,20 +1371,24 @@ void rgblight_effect_knight(animation_status_t *anim) {
         led[i].w = 0;
 #    endif
     }
+    if (rgblight_phase_mode != RGBLIGHT_MODE_KNIGHT) {
+        for (i = 0; i < RGBLED_NUM; i++) {
+            rgblight_phase[i] = (i + RGBLIGHT_EFFECT_KNIGHT_OFFSET) % rgblight_ranges.effect_num_leds + rgblight_ranges.effect_start_pos;
+        }
+        rgblight_phase_mode = RGBLIGHT_MODE_KNIGHT;
+    }
+    // Every lit LED shares one colour
+    sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, &lit);
+
     // Determine which LEDs should be lit up
     for (i = 0; i < RGBLIGHT_EFFECT_KNIGHT_LED_NUM; i++) {
-        cur = (i + RGBLIGHT_EFFECT_KNIGHT_OFFSET) % rgblight_ranges.effect_num_leds + rgblight_ranges.effect_start_pos;
-
-        if (i >= low_bound && i <= high_bound) {
-            sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, (LED_TYPE *)&led[cur]);
+        if (i < RGBLED_NUM) {
+            cur = rgblight_phase[i];
         } else {
-            led[cur].r = 0;
-            led[cur].g = 0;
-            led[cur].b = 0;
-#    ifdef RGBW
-            led[cur].w = 0;
-#    endif
+            cur = (i + RGBLIGHT_EFFECT_KNIGHT_OFFSET) % rgblight_ranges.effect_num_leds + rgblight_ranges.effect_start_pos;
         }
+
+        led[cur] = (i >= low_bound && i <= high_bound) ? lit : off;
     }
     rgblight_set();
 